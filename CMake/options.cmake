@@ -87,9 +87,20 @@ if (APPLE)
   option (OPTION_APPLE_SDL "use SDL" OFF)
 endif (APPLE)
 
+#######################################################################
+if (UNIX AND NOT APPLE)
+  option (OPTION_USE_HEADLESS "use the headless platform (no display, windows are drawn in memory)" OFF)
+endif (UNIX AND NOT APPLE)
+
+if (OPTION_USE_HEADLESS)
+  set (USE_HEADLESS 1)
+  add_definitions (-DUSE_HEADLESS)
+  list (APPEND FLTK_CFLAGS -DUSE_HEADLESS)
+endif (OPTION_USE_HEADLESS)
+
 # find X11 libraries and headers
 set (PATH_TO_XLIBS)
-if ((NOT APPLE OR OPTION_APPLE_X11) AND NOT WIN32)
+if ((NOT APPLE OR OPTION_APPLE_X11) AND NOT WIN32 AND NOT OPTION_USE_HEADLESS)
   include (FindX11)
   if (X11_FOUND)
     set (USE_X11 1)
@@ -197,7 +208,7 @@ if(OPTION_USE_GL)
    if(OPTION_APPLE_X11)
       set(OPENGL_FOUND TRUE)
       set(OPENGL_LIBRARIES -L${PATH_TO_XLIBS} -lGLU -lGL)
-   elseif(OPTION_APPLE_SDL)
+   elseif(OPTION_APPLE_SDL OR OPTION_USE_HEADLESS)
       set(OPENGL_FOUND FALSE)
    else()
       include(FindOpenGL)
@@ -534,6 +545,18 @@ else()
    set(FLTK_XDBE_FOUND FALSE)
 endif(OPTION_USE_XDBE AND HAVE_XDBE_H)
 
+#######################################################################
+if(X11_FOUND)
+   option(OPTION_USE_XSHM "use MIT-SHM extension of lib Xext" ON)
+endif(X11_FOUND)
+
+if(OPTION_USE_XSHM AND HAVE_XSHM_H AND X11_Xext_FOUND)
+   set(HAVE_XSHM 1)
+   set(FLTK_XSHM_FOUND TRUE)
+else()
+   set(FLTK_XSHM_FOUND FALSE)
+endif(OPTION_USE_XSHM AND HAVE_XSHM_H AND X11_Xext_FOUND)
+
 #######################################################################
 set(FL_NO_PRINT_SUPPORT FALSE)
 if(X11_FOUND AND NOT OPTION_PRINT_SUPPORT)
@@ -0,0 +1,181 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMake/FLTKConfig.cmake.in"
+  "/root/repo/CMake/UseFLTK.cmake.in"
+  "/root/repo/CMake/cmake_uninstall.cmake.in"
+  "/root/repo/CMake/export.cmake"
+  "/root/repo/CMake/install.cmake"
+  "/root/repo/CMake/macros.cmake"
+  "/root/repo/CMake/options.cmake"
+  "/root/repo/CMake/resources.cmake"
+  "/root/repo/CMake/setup.cmake"
+  "/root/repo/CMake/variables.cmake"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/abi-version.cmake.in"
+  "/root/repo/configh.cmake.in"
+  "/root/repo/fltk-config.in"
+  "/root/repo/fluid/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/browser.cxx"
+  "/root/repo/test/demo.menu"
+  "/root/repo/test/editor.cxx"
+  "/root/repo/test/help_dialog.html"
+  "/root/repo/test/rgb.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FLTKCompatibility.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindJPEG.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPNG.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/TestBigEndian.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "FLTKConfig.cmake"
+  "UseFLTK.cmake"
+  "fltk-config"
+  "config.h"
+  "FL/abi-version.h"
+  "cmake_uninstall.cmake"
+  "etc/FLTKConfig.cmake"
+  "etc/UseFLTK.cmake"
+  "bin/fltk-config"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fluid/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bin/examples/demo.menu"
+  "bin/examples/rgb.txt"
+  "bin/examples/help_dialog.html"
+  "bin/examples/browser.cxx"
+  "bin/examples/editor.cxx"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "fluid/CMakeFiles/fluid.dir/DependInfo.cmake"
+  "src/CMakeFiles/fltk.dir/DependInfo.cmake"
+  "src/CMakeFiles/fltk_forms.dir/DependInfo.cmake"
+  "src/CMakeFiles/fltk_images.dir/DependInfo.cmake"
+  "test/CMakeFiles/adjuster.dir/DependInfo.cmake"
+  "test/CMakeFiles/arc.dir/DependInfo.cmake"
+  "test/CMakeFiles/animated.dir/DependInfo.cmake"
+  "test/CMakeFiles/ask.dir/DependInfo.cmake"
+  "test/CMakeFiles/async_images.dir/DependInfo.cmake"
+  "test/CMakeFiles/bitmap.dir/DependInfo.cmake"
+  "test/CMakeFiles/blocks.dir/DependInfo.cmake"
+  "test/CMakeFiles/boxtype.dir/DependInfo.cmake"
+  "test/CMakeFiles/browser.dir/DependInfo.cmake"
+  "test/CMakeFiles/button.dir/DependInfo.cmake"
+  "test/CMakeFiles/buttons.dir/DependInfo.cmake"
+  "test/CMakeFiles/checkers.dir/DependInfo.cmake"
+  "test/CMakeFiles/clock.dir/DependInfo.cmake"
+  "test/CMakeFiles/colbrowser.dir/DependInfo.cmake"
+  "test/CMakeFiles/color_chooser.dir/DependInfo.cmake"
+  "test/CMakeFiles/cursor.dir/DependInfo.cmake"
+  "test/CMakeFiles/curve.dir/DependInfo.cmake"
+  "test/CMakeFiles/demo.dir/DependInfo.cmake"
+  "test/CMakeFiles/device.dir/DependInfo.cmake"
+  "test/CMakeFiles/doublebuffer.dir/DependInfo.cmake"
+  "test/CMakeFiles/draw_image.dir/DependInfo.cmake"
+  "test/CMakeFiles/editor.dir/DependInfo.cmake"
+  "test/CMakeFiles/fast_slow.dir/DependInfo.cmake"
+  "test/CMakeFiles/file_chooser.dir/DependInfo.cmake"
+  "test/CMakeFiles/fonts.dir/DependInfo.cmake"
+  "test/CMakeFiles/forms.dir/DependInfo.cmake"
+  "test/CMakeFiles/hello.dir/DependInfo.cmake"
+  "test/CMakeFiles/help_dialog.dir/DependInfo.cmake"
+  "test/CMakeFiles/icon.dir/DependInfo.cmake"
+  "test/CMakeFiles/iconize.dir/DependInfo.cmake"
+  "test/CMakeFiles/image.dir/DependInfo.cmake"
+  "test/CMakeFiles/inactive.dir/DependInfo.cmake"
+  "test/CMakeFiles/input.dir/DependInfo.cmake"
+  "test/CMakeFiles/input_choice.dir/DependInfo.cmake"
+  "test/CMakeFiles/keyboard.dir/DependInfo.cmake"
+  "test/CMakeFiles/label.dir/DependInfo.cmake"
+  "test/CMakeFiles/line_style.dir/DependInfo.cmake"
+  "test/CMakeFiles/list_visuals.dir/DependInfo.cmake"
+  "test/CMakeFiles/mandelbrot.dir/DependInfo.cmake"
+  "test/CMakeFiles/menubar.dir/DependInfo.cmake"
+  "test/CMakeFiles/message.dir/DependInfo.cmake"
+  "test/CMakeFiles/minimum.dir/DependInfo.cmake"
+  "test/CMakeFiles/native-filechooser.dir/DependInfo.cmake"
+  "test/CMakeFiles/navigation.dir/DependInfo.cmake"
+  "test/CMakeFiles/output.dir/DependInfo.cmake"
+  "test/CMakeFiles/overlay.dir/DependInfo.cmake"
+  "test/CMakeFiles/pack.dir/DependInfo.cmake"
+  "test/CMakeFiles/pixmap.dir/DependInfo.cmake"
+  "test/CMakeFiles/pixmap_browser.dir/DependInfo.cmake"
+  "test/CMakeFiles/preferences.dir/DependInfo.cmake"
+  "test/CMakeFiles/offscreen.dir/DependInfo.cmake"
+  "test/CMakeFiles/radio.dir/DependInfo.cmake"
+  "test/CMakeFiles/resize.dir/DependInfo.cmake"
+  "test/CMakeFiles/resizebox.dir/DependInfo.cmake"
+  "test/CMakeFiles/rotated_text.dir/DependInfo.cmake"
+  "test/CMakeFiles/scroll.dir/DependInfo.cmake"
+  "test/CMakeFiles/subwindow.dir/DependInfo.cmake"
+  "test/CMakeFiles/sudoku.dir/DependInfo.cmake"
+  "test/CMakeFiles/symbols.dir/DependInfo.cmake"
+  "test/CMakeFiles/tabs.dir/DependInfo.cmake"
+  "test/CMakeFiles/table.dir/DependInfo.cmake"
+  "test/CMakeFiles/threads.dir/DependInfo.cmake"
+  "test/CMakeFiles/tile.dir/DependInfo.cmake"
+  "test/CMakeFiles/tiled_image.dir/DependInfo.cmake"
+  "test/CMakeFiles/tree.dir/DependInfo.cmake"
+  "test/CMakeFiles/twowin.dir/DependInfo.cmake"
+  "test/CMakeFiles/utf8.dir/DependInfo.cmake"
+  "test/CMakeFiles/valuators.dir/DependInfo.cmake"
+  "test/CMakeFiles/unittests.dir/DependInfo.cmake"
+  "test/CMakeFiles/windowfocus.dir/DependInfo.cmake"
+  "test/CMakeFiles/fltk-versions.dir/DependInfo.cmake"
+  "test/CMakeFiles/headless_draw.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,25 @@
+#
+# UseFLTK.CMake - FLTK CMake environment configuration file for external projects.
+#
+# This file is generated by CMake and used to set FLTK's environment for an external project.
+#
+# automatically generated - do not edit
+
+include_directories("/root/repo/_headless_build;/root/repo")
+
+if(CMAKE_CROSSCOMPILING)
+   find_file(FLUID_PATH
+      NAMES fluid fluid.exe
+      PATHS ENV PATH
+      NO_CMAKE_FIND_ROOT_PATH
+   )
+   add_executable(fluid IMPORTED)
+   set_target_properties(fluid
+      PROPERTIES IMPORTED_LOCATION ${FLUID_PATH}
+   )
+   set(FLTK_FLUID_EXECUTABLE ${FLUID_PATH})
+else()
+   set(FLTK_FLUID_EXECUTABLE fluid)
+endif(CMAKE_CROSSCOMPILING)
+
+set(FLTK_WRAP_UI TRUE)
@@ -0,0 +1,16 @@
+#
+# FLTKConfig.cmake - FLTK CMake configuration file for external projects.
+#
+# This file is generated by CMake and used to load FLTK's settings for an external project.
+# It defines the following variables
+#  FLTK_INCLUDE_DIRS - FLTK include directories
+#  FLTK_LIBRARIES    - list of FLTK libraries built
+#  FLTK_FLUID_EXECUTABLE needed by fltk_wrap_ui()
+#  FLTK_USE_FILE - sets things up to use FLTK
+
+set(FLTK_VERSION 1.4.0)
+
+include(${CMAKE_CURRENT_LIST_DIR}/FLTK-Targets.cmake)
+
+set(FLTK_INCLUDE_DIRS "/usr/local/include")
+set(FLTK_USE_FILE ${CMAKE_CURRENT_LIST_DIR}/UseFLTK.cmake)
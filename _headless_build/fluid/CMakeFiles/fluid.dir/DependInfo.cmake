@@ -0,0 +1,41 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/fluid/CodeEditor.cxx" "fluid/CMakeFiles/fluid.dir/CodeEditor.cxx.o" "gcc" "fluid/CMakeFiles/fluid.dir/CodeEditor.cxx.o.d"
+  "/root/repo/fluid/ExternalCodeEditor_UNIX.cxx" "fluid/CMakeFiles/fluid.dir/ExternalCodeEditor_UNIX.cxx.o" "gcc" "fluid/CMakeFiles/fluid.dir/ExternalCodeEditor_UNIX.cxx.o.d"
+  "/root/repo/fluid/Fl_Function_Type.cxx" "fluid/CMakeFiles/fluid.dir/Fl_Function_Type.cxx.o" "gcc" "fluid/CMakeFiles/fluid.dir/Fl_Function_Type.cxx.o.d"
+  "/root/repo/fluid/Fl_Group_Type.cxx" "fluid/CMakeFiles/fluid.dir/Fl_Group_Type.cxx.o" "gcc" "fluid/CMakeFiles/fluid.dir/Fl_Group_Type.cxx.o.d"
+  "/root/repo/fluid/Fl_Menu_Type.cxx" "fluid/CMakeFiles/fluid.dir/Fl_Menu_Type.cxx.o" "gcc" "fluid/CMakeFiles/fluid.dir/Fl_Menu_Type.cxx.o.d"
+  "/root/repo/fluid/Fl_Type.cxx" "fluid/CMakeFiles/fluid.dir/Fl_Type.cxx.o" "gcc" "fluid/CMakeFiles/fluid.dir/Fl_Type.cxx.o.d"
+  "/root/repo/fluid/Fl_Widget_Type.cxx" "fluid/CMakeFiles/fluid.dir/Fl_Widget_Type.cxx.o" "gcc" "fluid/CMakeFiles/fluid.dir/Fl_Widget_Type.cxx.o.d"
+  "/root/repo/fluid/Fl_Window_Type.cxx" "fluid/CMakeFiles/fluid.dir/Fl_Window_Type.cxx.o" "gcc" "fluid/CMakeFiles/fluid.dir/Fl_Window_Type.cxx.o.d"
+  "/root/repo/fluid/Fluid_Image.cxx" "fluid/CMakeFiles/fluid.dir/Fluid_Image.cxx.o" "gcc" "fluid/CMakeFiles/fluid.dir/Fluid_Image.cxx.o.d"
+  "/root/repo/fluid/about_panel.cxx" "fluid/CMakeFiles/fluid.dir/about_panel.cxx.o" "gcc" "fluid/CMakeFiles/fluid.dir/about_panel.cxx.o.d"
+  "/root/repo/fluid/align_widget.cxx" "fluid/CMakeFiles/fluid.dir/align_widget.cxx.o" "gcc" "fluid/CMakeFiles/fluid.dir/align_widget.cxx.o.d"
+  "/root/repo/fluid/alignment_panel.cxx" "fluid/CMakeFiles/fluid.dir/alignment_panel.cxx.o" "gcc" "fluid/CMakeFiles/fluid.dir/alignment_panel.cxx.o.d"
+  "/root/repo/fluid/code.cxx" "fluid/CMakeFiles/fluid.dir/code.cxx.o" "gcc" "fluid/CMakeFiles/fluid.dir/code.cxx.o.d"
+  "/root/repo/fluid/factory.cxx" "fluid/CMakeFiles/fluid.dir/factory.cxx.o" "gcc" "fluid/CMakeFiles/fluid.dir/factory.cxx.o.d"
+  "/root/repo/fluid/file.cxx" "fluid/CMakeFiles/fluid.dir/file.cxx.o" "gcc" "fluid/CMakeFiles/fluid.dir/file.cxx.o.d"
+  "/root/repo/fluid/fluid.cxx" "fluid/CMakeFiles/fluid.dir/fluid.cxx.o" "gcc" "fluid/CMakeFiles/fluid.dir/fluid.cxx.o.d"
+  "/root/repo/fluid/function_panel.cxx" "fluid/CMakeFiles/fluid.dir/function_panel.cxx.o" "gcc" "fluid/CMakeFiles/fluid.dir/function_panel.cxx.o.d"
+  "/root/repo/fluid/template_panel.cxx" "fluid/CMakeFiles/fluid.dir/template_panel.cxx.o" "gcc" "fluid/CMakeFiles/fluid.dir/template_panel.cxx.o.d"
+  "/root/repo/fluid/undo.cxx" "fluid/CMakeFiles/fluid.dir/undo.cxx.o" "gcc" "fluid/CMakeFiles/fluid.dir/undo.cxx.o.d"
+  "/root/repo/fluid/widget_panel.cxx" "fluid/CMakeFiles/fluid.dir/widget_panel.cxx.o" "gcc" "fluid/CMakeFiles/fluid.dir/widget_panel.cxx.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_headless_build/src/CMakeFiles/fltk.dir/DependInfo.cmake"
+  "/root/repo/_headless_build/src/CMakeFiles/fltk_images.dir/DependInfo.cmake"
+  "/root/repo/_headless_build/src/CMakeFiles/fltk_forms.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
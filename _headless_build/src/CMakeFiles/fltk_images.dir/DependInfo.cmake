@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Fl_BMP_Image.cxx" "src/CMakeFiles/fltk_images.dir/Fl_BMP_Image.cxx.o" "gcc" "src/CMakeFiles/fltk_images.dir/Fl_BMP_Image.cxx.o.d"
+  "/root/repo/src/Fl_File_Icon2.cxx" "src/CMakeFiles/fltk_images.dir/Fl_File_Icon2.cxx.o" "gcc" "src/CMakeFiles/fltk_images.dir/Fl_File_Icon2.cxx.o.d"
+  "/root/repo/src/Fl_GIF_Image.cxx" "src/CMakeFiles/fltk_images.dir/Fl_GIF_Image.cxx.o" "gcc" "src/CMakeFiles/fltk_images.dir/Fl_GIF_Image.cxx.o.d"
+  "/root/repo/src/Fl_Help_Dialog.cxx" "src/CMakeFiles/fltk_images.dir/Fl_Help_Dialog.cxx.o" "gcc" "src/CMakeFiles/fltk_images.dir/Fl_Help_Dialog.cxx.o.d"
+  "/root/repo/src/Fl_JPEG_Image.cxx" "src/CMakeFiles/fltk_images.dir/Fl_JPEG_Image.cxx.o" "gcc" "src/CMakeFiles/fltk_images.dir/Fl_JPEG_Image.cxx.o.d"
+  "/root/repo/src/Fl_PNG_Image.cxx" "src/CMakeFiles/fltk_images.dir/Fl_PNG_Image.cxx.o" "gcc" "src/CMakeFiles/fltk_images.dir/Fl_PNG_Image.cxx.o.d"
+  "/root/repo/src/Fl_PNM_Image.cxx" "src/CMakeFiles/fltk_images.dir/Fl_PNM_Image.cxx.o" "gcc" "src/CMakeFiles/fltk_images.dir/Fl_PNM_Image.cxx.o.d"
+  "/root/repo/src/Fl_SVG_Image.cxx" "src/CMakeFiles/fltk_images.dir/Fl_SVG_Image.cxx.o" "gcc" "src/CMakeFiles/fltk_images.dir/Fl_SVG_Image.cxx.o.d"
+  "/root/repo/src/fl_images_core.cxx" "src/CMakeFiles/fltk_images.dir/fl_images_core.cxx.o" "gcc" "src/CMakeFiles/fltk_images.dir/fl_images_core.cxx.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_headless_build/src/CMakeFiles/fltk.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
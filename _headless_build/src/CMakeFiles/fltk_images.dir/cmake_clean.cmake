@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "../lib/libfltk_images.a"
+  "../lib/libfltk_images.pdb"
+  "CMakeFiles/fltk_images.dir/Fl_BMP_Image.cxx.o"
+  "CMakeFiles/fltk_images.dir/Fl_BMP_Image.cxx.o.d"
+  "CMakeFiles/fltk_images.dir/Fl_File_Icon2.cxx.o"
+  "CMakeFiles/fltk_images.dir/Fl_File_Icon2.cxx.o.d"
+  "CMakeFiles/fltk_images.dir/Fl_GIF_Image.cxx.o"
+  "CMakeFiles/fltk_images.dir/Fl_GIF_Image.cxx.o.d"
+  "CMakeFiles/fltk_images.dir/Fl_Help_Dialog.cxx.o"
+  "CMakeFiles/fltk_images.dir/Fl_Help_Dialog.cxx.o.d"
+  "CMakeFiles/fltk_images.dir/Fl_JPEG_Image.cxx.o"
+  "CMakeFiles/fltk_images.dir/Fl_JPEG_Image.cxx.o.d"
+  "CMakeFiles/fltk_images.dir/Fl_PNG_Image.cxx.o"
+  "CMakeFiles/fltk_images.dir/Fl_PNG_Image.cxx.o.d"
+  "CMakeFiles/fltk_images.dir/Fl_PNM_Image.cxx.o"
+  "CMakeFiles/fltk_images.dir/Fl_PNM_Image.cxx.o.d"
+  "CMakeFiles/fltk_images.dir/Fl_SVG_Image.cxx.o"
+  "CMakeFiles/fltk_images.dir/Fl_SVG_Image.cxx.o.d"
+  "CMakeFiles/fltk_images.dir/fl_images_core.cxx.o"
+  "CMakeFiles/fltk_images.dir/fl_images_core.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fltk_images.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
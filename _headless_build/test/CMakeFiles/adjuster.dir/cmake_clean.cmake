@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/adjuster"
+  "../bin/examples/adjuster.pdb"
+  "CMakeFiles/adjuster.dir/adjuster.cxx.o"
+  "CMakeFiles/adjuster.dir/adjuster.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adjuster.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
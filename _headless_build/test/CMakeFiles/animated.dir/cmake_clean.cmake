@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/animated"
+  "../bin/examples/animated.pdb"
+  "CMakeFiles/animated.dir/animated.cxx.o"
+  "CMakeFiles/animated.dir/animated.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/animated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
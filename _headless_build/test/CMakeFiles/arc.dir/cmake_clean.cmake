@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/arc"
+  "../bin/examples/arc.pdb"
+  "CMakeFiles/arc.dir/arc.cxx.o"
+  "CMakeFiles/arc.dir/arc.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/arc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
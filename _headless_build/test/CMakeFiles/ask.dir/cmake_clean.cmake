@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/ask"
+  "../bin/examples/ask.pdb"
+  "CMakeFiles/ask.dir/ask.cxx.o"
+  "CMakeFiles/ask.dir/ask.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ask.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/async_images"
+  "../bin/examples/async_images.pdb"
+  "CMakeFiles/async_images.dir/async_images.cxx.o"
+  "CMakeFiles/async_images.dir/async_images.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/async_images.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
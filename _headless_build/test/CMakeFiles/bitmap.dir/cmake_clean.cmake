@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/bitmap"
+  "../bin/examples/bitmap.pdb"
+  "CMakeFiles/bitmap.dir/bitmap.cxx.o"
+  "CMakeFiles/bitmap.dir/bitmap.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bitmap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
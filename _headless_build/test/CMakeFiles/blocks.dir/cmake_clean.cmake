@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/blocks"
+  "../bin/examples/blocks.pdb"
+  "CMakeFiles/blocks.dir/blocks.cxx.o"
+  "CMakeFiles/blocks.dir/blocks.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/blocks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
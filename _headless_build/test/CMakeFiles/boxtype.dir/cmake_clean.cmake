@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/boxtype"
+  "../bin/examples/boxtype.pdb"
+  "CMakeFiles/boxtype.dir/boxtype.cxx.o"
+  "CMakeFiles/boxtype.dir/boxtype.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/boxtype.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
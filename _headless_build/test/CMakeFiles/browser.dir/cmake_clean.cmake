@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/browser"
+  "../bin/examples/browser.pdb"
+  "CMakeFiles/browser.dir/browser.cxx.o"
+  "CMakeFiles/browser.dir/browser.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/browser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
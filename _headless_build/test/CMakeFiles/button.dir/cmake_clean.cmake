@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/button"
+  "../bin/examples/button.pdb"
+  "CMakeFiles/button.dir/button.cxx.o"
+  "CMakeFiles/button.dir/button.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/button.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/buttons"
+  "../bin/examples/buttons.pdb"
+  "CMakeFiles/buttons.dir/buttons.cxx.o"
+  "CMakeFiles/buttons.dir/buttons.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/buttons.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/checkers"
+  "../bin/examples/checkers.pdb"
+  "CMakeFiles/checkers.dir/checkers.cxx.o"
+  "CMakeFiles/checkers.dir/checkers.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/checkers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
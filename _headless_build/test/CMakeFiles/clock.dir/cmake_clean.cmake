@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/clock"
+  "../bin/examples/clock.pdb"
+  "CMakeFiles/clock.dir/clock.cxx.o"
+  "CMakeFiles/clock.dir/clock.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clock.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
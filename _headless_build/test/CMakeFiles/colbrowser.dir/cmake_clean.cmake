@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/colbrowser"
+  "../bin/examples/colbrowser.pdb"
+  "CMakeFiles/colbrowser.dir/colbrowser.cxx.o"
+  "CMakeFiles/colbrowser.dir/colbrowser.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/colbrowser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
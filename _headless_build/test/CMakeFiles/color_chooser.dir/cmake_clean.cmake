@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/color_chooser"
+  "../bin/examples/color_chooser.pdb"
+  "CMakeFiles/color_chooser.dir/color_chooser.cxx.o"
+  "CMakeFiles/color_chooser.dir/color_chooser.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/color_chooser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/cursor"
+  "../bin/examples/cursor.pdb"
+  "CMakeFiles/cursor.dir/cursor.cxx.o"
+  "CMakeFiles/cursor.dir/cursor.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cursor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
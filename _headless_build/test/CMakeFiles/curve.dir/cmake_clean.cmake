@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/curve"
+  "../bin/examples/curve.pdb"
+  "CMakeFiles/curve.dir/curve.cxx.o"
+  "CMakeFiles/curve.dir/curve.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/curve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
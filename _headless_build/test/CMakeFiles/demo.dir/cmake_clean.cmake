@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/demo"
+  "../bin/examples/demo.pdb"
+  "CMakeFiles/demo.dir/demo.cxx.o"
+  "CMakeFiles/demo.dir/demo.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/demo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
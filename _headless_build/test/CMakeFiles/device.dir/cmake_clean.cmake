@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/device"
+  "../bin/examples/device.pdb"
+  "CMakeFiles/device.dir/device.cxx.o"
+  "CMakeFiles/device.dir/device.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/device.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/doublebuffer"
+  "../bin/examples/doublebuffer.pdb"
+  "CMakeFiles/doublebuffer.dir/doublebuffer.cxx.o"
+  "CMakeFiles/doublebuffer.dir/doublebuffer.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/doublebuffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/draw_image"
+  "../bin/examples/draw_image.pdb"
+  "CMakeFiles/draw_image.dir/draw_image.cxx.o"
+  "CMakeFiles/draw_image.dir/draw_image.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/draw_image.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
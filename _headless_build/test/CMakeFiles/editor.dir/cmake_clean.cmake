@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/editor"
+  "../bin/examples/editor.pdb"
+  "CMakeFiles/editor.dir/editor.cxx.o"
+  "CMakeFiles/editor.dir/editor.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/editor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
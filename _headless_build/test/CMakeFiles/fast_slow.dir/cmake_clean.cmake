@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../bin/examples/fast_slow"
+  "../bin/examples/fast_slow.pdb"
+  "CMakeFiles/fast_slow.dir/fast_slow.cxx.o"
+  "CMakeFiles/fast_slow.dir/fast_slow.cxx.o.d"
+  "fast_slow.cxx"
+  "fast_slow.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fast_slow.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
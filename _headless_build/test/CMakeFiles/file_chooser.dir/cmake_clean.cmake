@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/file_chooser"
+  "../bin/examples/file_chooser.pdb"
+  "CMakeFiles/file_chooser.dir/file_chooser.cxx.o"
+  "CMakeFiles/file_chooser.dir/file_chooser.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/file_chooser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
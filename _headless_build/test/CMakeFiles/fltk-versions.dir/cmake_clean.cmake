@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/fltk-versions"
+  "../bin/examples/fltk-versions.pdb"
+  "CMakeFiles/fltk-versions.dir/__/examples/fltk-versions.cxx.o"
+  "CMakeFiles/fltk-versions.dir/__/examples/fltk-versions.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fltk-versions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/fonts"
+  "../bin/examples/fonts.pdb"
+  "CMakeFiles/fonts.dir/fonts.cxx.o"
+  "CMakeFiles/fonts.dir/fonts.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fonts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
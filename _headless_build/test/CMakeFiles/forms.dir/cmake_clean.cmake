@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/forms"
+  "../bin/examples/forms.pdb"
+  "CMakeFiles/forms.dir/forms.cxx.o"
+  "CMakeFiles/forms.dir/forms.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/forms.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/headless_draw"
+  "../bin/examples/headless_draw.pdb"
+  "CMakeFiles/headless_draw.dir/headless_draw.cxx.o"
+  "CMakeFiles/headless_draw.dir/headless_draw.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/headless_draw.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
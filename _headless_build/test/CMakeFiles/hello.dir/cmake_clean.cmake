@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/hello"
+  "../bin/examples/hello.pdb"
+  "CMakeFiles/hello.dir/hello.cxx.o"
+  "CMakeFiles/hello.dir/hello.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hello.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/help_dialog"
+  "../bin/examples/help_dialog.pdb"
+  "CMakeFiles/help_dialog.dir/help_dialog.cxx.o"
+  "CMakeFiles/help_dialog.dir/help_dialog.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/help_dialog.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/icon"
+  "../bin/examples/icon.pdb"
+  "CMakeFiles/icon.dir/icon.cxx.o"
+  "CMakeFiles/icon.dir/icon.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/icon.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/iconize"
+  "../bin/examples/iconize.pdb"
+  "CMakeFiles/iconize.dir/iconize.cxx.o"
+  "CMakeFiles/iconize.dir/iconize.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iconize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/image"
+  "../bin/examples/image.pdb"
+  "CMakeFiles/image.dir/image.cxx.o"
+  "CMakeFiles/image.dir/image.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/image.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
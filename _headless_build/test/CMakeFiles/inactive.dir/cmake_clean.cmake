@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../bin/examples/inactive"
+  "../bin/examples/inactive.pdb"
+  "CMakeFiles/inactive.dir/inactive.cxx.o"
+  "CMakeFiles/inactive.dir/inactive.cxx.o.d"
+  "inactive.cxx"
+  "inactive.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/inactive.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/input"
+  "../bin/examples/input.pdb"
+  "CMakeFiles/input.dir/input.cxx.o"
+  "CMakeFiles/input.dir/input.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/input.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
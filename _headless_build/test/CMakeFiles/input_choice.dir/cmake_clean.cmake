@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/input_choice"
+  "../bin/examples/input_choice.pdb"
+  "CMakeFiles/input_choice.dir/input_choice.cxx.o"
+  "CMakeFiles/input_choice.dir/input_choice.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/input_choice.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
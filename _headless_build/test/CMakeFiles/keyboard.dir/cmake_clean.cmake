@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../bin/examples/keyboard"
+  "../bin/examples/keyboard.pdb"
+  "CMakeFiles/keyboard.dir/keyboard.cxx.o"
+  "CMakeFiles/keyboard.dir/keyboard.cxx.o.d"
+  "CMakeFiles/keyboard.dir/keyboard_ui.cxx.o"
+  "CMakeFiles/keyboard.dir/keyboard_ui.cxx.o.d"
+  "keyboard_ui.cxx"
+  "keyboard_ui.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/keyboard.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/label"
+  "../bin/examples/label.pdb"
+  "CMakeFiles/label.dir/label.cxx.o"
+  "CMakeFiles/label.dir/label.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/label.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/line_style"
+  "../bin/examples/line_style.pdb"
+  "CMakeFiles/line_style.dir/line_style.cxx.o"
+  "CMakeFiles/line_style.dir/line_style.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/line_style.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
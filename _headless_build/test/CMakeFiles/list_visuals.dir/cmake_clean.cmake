@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/list_visuals"
+  "../bin/examples/list_visuals.pdb"
+  "CMakeFiles/list_visuals.dir/list_visuals.cxx.o"
+  "CMakeFiles/list_visuals.dir/list_visuals.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/list_visuals.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
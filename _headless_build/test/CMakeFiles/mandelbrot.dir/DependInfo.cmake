@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/mandelbrot.cxx" "test/CMakeFiles/mandelbrot.dir/mandelbrot.cxx.o" "gcc" "test/CMakeFiles/mandelbrot.dir/mandelbrot.cxx.o.d"
+  "/root/repo/_headless_build/test/mandelbrot_ui.cxx" "test/CMakeFiles/mandelbrot.dir/mandelbrot_ui.cxx.o" "gcc" "test/CMakeFiles/mandelbrot.dir/mandelbrot_ui.cxx.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_headless_build/test/mandelbrot_ui.h" "/root/repo/_headless_build/test/mandelbrot_ui.cxx"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_headless_build/src/CMakeFiles/fltk.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../bin/examples/mandelbrot"
+  "../bin/examples/mandelbrot.pdb"
+  "CMakeFiles/mandelbrot.dir/mandelbrot.cxx.o"
+  "CMakeFiles/mandelbrot.dir/mandelbrot.cxx.o.d"
+  "CMakeFiles/mandelbrot.dir/mandelbrot_ui.cxx.o"
+  "CMakeFiles/mandelbrot.dir/mandelbrot_ui.cxx.o.d"
+  "mandelbrot_ui.cxx"
+  "mandelbrot_ui.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mandelbrot.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/menubar"
+  "../bin/examples/menubar.pdb"
+  "CMakeFiles/menubar.dir/menubar.cxx.o"
+  "CMakeFiles/menubar.dir/menubar.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/menubar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/message"
+  "../bin/examples/message.pdb"
+  "CMakeFiles/message.dir/message.cxx.o"
+  "CMakeFiles/message.dir/message.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/message.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
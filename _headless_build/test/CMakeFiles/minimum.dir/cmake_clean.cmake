@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/minimum"
+  "../bin/examples/minimum.pdb"
+  "CMakeFiles/minimum.dir/minimum.cxx.o"
+  "CMakeFiles/minimum.dir/minimum.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/minimum.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/native-filechooser"
+  "../bin/examples/native-filechooser.pdb"
+  "CMakeFiles/native-filechooser.dir/native-filechooser.cxx.o"
+  "CMakeFiles/native-filechooser.dir/native-filechooser.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/native-filechooser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/navigation"
+  "../bin/examples/navigation.pdb"
+  "CMakeFiles/navigation.dir/navigation.cxx.o"
+  "CMakeFiles/navigation.dir/navigation.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/navigation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
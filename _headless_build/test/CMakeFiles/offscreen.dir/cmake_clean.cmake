@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/offscreen"
+  "../bin/examples/offscreen.pdb"
+  "CMakeFiles/offscreen.dir/offscreen.cxx.o"
+  "CMakeFiles/offscreen.dir/offscreen.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/offscreen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/output"
+  "../bin/examples/output.pdb"
+  "CMakeFiles/output.dir/output.cxx.o"
+  "CMakeFiles/output.dir/output.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/output.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/overlay"
+  "../bin/examples/overlay.pdb"
+  "CMakeFiles/overlay.dir/overlay.cxx.o"
+  "CMakeFiles/overlay.dir/overlay.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/overlay.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
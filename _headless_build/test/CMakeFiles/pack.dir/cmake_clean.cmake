@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/pack"
+  "../bin/examples/pack.pdb"
+  "CMakeFiles/pack.dir/pack.cxx.o"
+  "CMakeFiles/pack.dir/pack.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
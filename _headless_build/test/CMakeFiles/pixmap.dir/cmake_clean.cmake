@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/pixmap"
+  "../bin/examples/pixmap.pdb"
+  "CMakeFiles/pixmap.dir/pixmap.cxx.o"
+  "CMakeFiles/pixmap.dir/pixmap.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pixmap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
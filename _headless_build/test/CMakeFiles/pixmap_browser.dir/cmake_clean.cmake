@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/pixmap_browser"
+  "../bin/examples/pixmap_browser.pdb"
+  "CMakeFiles/pixmap_browser.dir/pixmap_browser.cxx.o"
+  "CMakeFiles/pixmap_browser.dir/pixmap_browser.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pixmap_browser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
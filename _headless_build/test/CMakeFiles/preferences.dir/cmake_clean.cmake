@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../bin/examples/preferences"
+  "../bin/examples/preferences.pdb"
+  "CMakeFiles/preferences.dir/preferences.cxx.o"
+  "CMakeFiles/preferences.dir/preferences.cxx.o.d"
+  "preferences.cxx"
+  "preferences.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/preferences.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
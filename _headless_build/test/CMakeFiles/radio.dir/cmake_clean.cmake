@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../bin/examples/radio"
+  "../bin/examples/radio.pdb"
+  "CMakeFiles/radio.dir/radio.cxx.o"
+  "CMakeFiles/radio.dir/radio.cxx.o.d"
+  "radio.cxx"
+  "radio.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/radio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../bin/examples/resize"
+  "../bin/examples/resize.pdb"
+  "CMakeFiles/resize.dir/resize.cxx.o"
+  "CMakeFiles/resize.dir/resize.cxx.o.d"
+  "resize.cxx"
+  "resize.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/resize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
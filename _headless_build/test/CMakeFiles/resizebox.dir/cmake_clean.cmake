@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/resizebox"
+  "../bin/examples/resizebox.pdb"
+  "CMakeFiles/resizebox.dir/resizebox.cxx.o"
+  "CMakeFiles/resizebox.dir/resizebox.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/resizebox.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/rotated_text"
+  "../bin/examples/rotated_text.pdb"
+  "CMakeFiles/rotated_text.dir/rotated_text.cxx.o"
+  "CMakeFiles/rotated_text.dir/rotated_text.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rotated_text.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/scroll"
+  "../bin/examples/scroll.pdb"
+  "CMakeFiles/scroll.dir/scroll.cxx.o"
+  "CMakeFiles/scroll.dir/scroll.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scroll.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/subwindow"
+  "../bin/examples/subwindow.pdb"
+  "CMakeFiles/subwindow.dir/subwindow.cxx.o"
+  "CMakeFiles/subwindow.dir/subwindow.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/subwindow.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/sudoku"
+  "../bin/examples/sudoku.pdb"
+  "CMakeFiles/sudoku.dir/sudoku.cxx.o"
+  "CMakeFiles/sudoku.dir/sudoku.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sudoku.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
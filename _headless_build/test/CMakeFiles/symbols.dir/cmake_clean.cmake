@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/symbols"
+  "../bin/examples/symbols.pdb"
+  "CMakeFiles/symbols.dir/symbols.cxx.o"
+  "CMakeFiles/symbols.dir/symbols.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/symbols.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
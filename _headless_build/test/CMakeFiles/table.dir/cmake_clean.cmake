@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/table"
+  "../bin/examples/table.pdb"
+  "CMakeFiles/table.dir/table.cxx.o"
+  "CMakeFiles/table.dir/table.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/table.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
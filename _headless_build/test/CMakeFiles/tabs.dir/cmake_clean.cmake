@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../bin/examples/tabs"
+  "../bin/examples/tabs.pdb"
+  "CMakeFiles/tabs.dir/tabs.cxx.o"
+  "CMakeFiles/tabs.dir/tabs.cxx.o.d"
+  "tabs.cxx"
+  "tabs.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tabs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/threads"
+  "../bin/examples/threads.pdb"
+  "CMakeFiles/threads.dir/threads.cxx.o"
+  "CMakeFiles/threads.dir/threads.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/threads.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
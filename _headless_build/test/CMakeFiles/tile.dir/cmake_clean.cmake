@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/tile"
+  "../bin/examples/tile.pdb"
+  "CMakeFiles/tile.dir/tile.cxx.o"
+  "CMakeFiles/tile.dir/tile.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tile.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
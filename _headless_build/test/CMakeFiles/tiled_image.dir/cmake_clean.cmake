@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/tiled_image"
+  "../bin/examples/tiled_image.pdb"
+  "CMakeFiles/tiled_image.dir/tiled_image.cxx.o"
+  "CMakeFiles/tiled_image.dir/tiled_image.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tiled_image.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
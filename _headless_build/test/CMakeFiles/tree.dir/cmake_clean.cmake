@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../bin/examples/tree"
+  "../bin/examples/tree.pdb"
+  "CMakeFiles/tree.dir/tree.cxx.o"
+  "CMakeFiles/tree.dir/tree.cxx.o.d"
+  "tree.cxx"
+  "tree.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tree.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/twowin"
+  "../bin/examples/twowin.pdb"
+  "CMakeFiles/twowin.dir/twowin.cxx.o"
+  "CMakeFiles/twowin.dir/twowin.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/twowin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/unittests"
+  "../bin/examples/unittests.pdb"
+  "CMakeFiles/unittests.dir/unittests.cxx.o"
+  "CMakeFiles/unittests.dir/unittests.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unittests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
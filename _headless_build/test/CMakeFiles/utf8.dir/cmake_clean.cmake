@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/utf8"
+  "../bin/examples/utf8.pdb"
+  "CMakeFiles/utf8.dir/utf8.cxx.o"
+  "CMakeFiles/utf8.dir/utf8.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/utf8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../bin/examples/valuators"
+  "../bin/examples/valuators.pdb"
+  "CMakeFiles/valuators.dir/valuators.cxx.o"
+  "CMakeFiles/valuators.dir/valuators.cxx.o.d"
+  "valuators.cxx"
+  "valuators.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/valuators.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
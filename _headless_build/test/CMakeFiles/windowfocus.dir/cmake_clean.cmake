@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/examples/windowfocus"
+  "../bin/examples/windowfocus.pdb"
+  "CMakeFiles/windowfocus.dir/windowfocus.cxx.o"
+  "CMakeFiles/windowfocus.dir/windowfocus.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/windowfocus.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
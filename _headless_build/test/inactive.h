@@ -0,0 +1,23 @@
+// generated by Fast Light User Interface Designer (fluid) version 1.0400
+
+#ifndef inactive_h
+#define inactive_h
+#include <FL/Fl.H>
+#include <FL/Fl_Double_Window.H>
+#include <FL/Fl_Group.H>
+extern Fl_Group *the_group;
+#include <FL/Fl_Button.H>
+#include <FL/Fl_Light_Button.H>
+#include <FL/Fl_Check_Button.H>
+#include <FL/Fl_Round_Button.H>
+#include <FL/Fl_Slider.H>
+#include <FL/Fl_Input.H>
+#include <FL/Fl_Menu_Button.H>
+#include <FL/Fl_Value_Output.H>
+#include <FL/Fl_Box.H>
+#include <FL/Fl_Scrollbar.H>
+#include <FL/Fl_Roller.H>
+#include <FL/Fl_Dial.H>
+#include <FL/Fl_Clock.H>
+extern Fl_Menu_Item menu_menu[];
+#endif
@@ -0,0 +1,23 @@
+// generated by Fast Light User Interface Designer (fluid) version 1.0400
+
+#ifndef valuators_h
+#define valuators_h
+#include <FL/Fl.H>
+#include <FL/Fl_Simple_Terminal.H>
+#include <FL/Fl_Double_Window.H>
+#include <stdio.h>
+#include <FL/Fl_Box.H>
+#include <FL/Fl_Slider.H>
+#include <FL/Fl_Value_Slider.H>
+#include <FL/Fl_Value_Input.H>
+#include <FL/Fl_Value_Output.H>
+#include <FL/Fl_Scrollbar.H>
+#include <FL/Fl_Adjuster.H>
+#include <FL/Fl_Counter.H>
+#include <FL/Fl_Spinner.H>
+#include <FL/Fl_Dial.H>
+#include <FL/Fl_Roller.H>
+extern Fl_Simple_Terminal *tty;
+void callback(Fl_Widget* o, void*);
+void callback_spinner(Fl_Widget* o, void*);
+#endif
@@ -702,7 +702,7 @@ void Fl::flush() {
       if (Fl_Window_Driver::driver(wi)->wait_for_expose_value) {damage_ = 1; continue;}
       if (!wi->visible_r()) continue;
       if (wi->damage()) {
-        Fl_Window_Driver::driver(wi)->flush();
+        Fl_Window_Driver::driver(wi)->flush_damage();
         wi->clear_damage();
       }
       // destroy damage regions for windows that don't use them:
@@ -1546,6 +1546,7 @@ void Fl_Widget::damage(uchar fl) {
       fl_graphics_driver->XDestroyRegion(i->region);
       i->region = 0;
     }
+    Fl_Window_Driver::driver((Fl_Window*)this)->damage_all();
     damage_ |= fl;
     Fl::damage(FL_DAMAGE_CHILD);
   }
@@ -1581,11 +1582,13 @@ void Fl_Widget::damage(uchar fl, int X, int Y, int W, int H) {
     if (i->region) {
       fl_graphics_driver->add_rectangle_to_region(i->region, X, Y, W, H);
     }
+    Fl_Window_Driver::driver((Fl_Window*)wi)->add_damage(X, Y, W, H);
     wi->damage_ |= fl;
   } else {
     // create a new region:
     if (i->region) fl_graphics_driver->XDestroyRegion(i->region);
     i->region = fl_graphics_driver->XRectangleRegion(X,Y,W,H);
+    Fl_Window_Driver::driver((Fl_Window*)wi)->reset_damage(X, Y, W, H);
     wi->damage_ = fl;
   }
   Fl::damage(FL_DAMAGE_CHILD);
@@ -25,6 +25,7 @@
 #include "Fl_Window_Driver.H"
 #include <FL/Fl_Rect.H>
 #include <FL/fl_draw.H>
+#include "Fl_Widget_Cache.H"
 
 #include <stdlib.h> // malloc etc.
 
@@ -790,6 +791,8 @@ void Fl_Group::resize(int X, int Y, int W, int H) {
   This is useful, if you derived a widget from Fl_Group and want to draw a special
   border or background. You can call draw_children() from the derived draw() method
   after drawing the box, border, or background.
+
+  \see occlude_children(int)
 */
 void Fl_Group::draw_children() {
   Fl_Widget*const* a = array();
@@ -801,7 +804,9 @@ void Fl_Group::draw_children() {
 		 h() - Fl::box_dh(box()));
   }
 
-  if (damage() & ~FL_DAMAGE_CHILD) { // redraw the entire thing:
+  if (occlude_children()) {
+    draw_occluded_children();
+  } else if (damage() & ~FL_DAMAGE_CHILD) { // redraw the entire thing:
     for (int i=children_; i--;) {
       Fl_Widget& o = **a++;
       draw_child(o);
@@ -814,6 +819,80 @@ void Fl_Group::draw_children() {
   if (clip_children()) fl_pop_clip();
 }
 
+extern int fl_box_opaque(Fl_Boxtype); // in fl_boxtype.cxx
+
+// An opaque child of a group, which hides the part of the children
+// before it that is inside x,y,r,b (r and b are excluded)
+struct Fl_Occluder {
+  int i; // index of the child
+  int x, y, r, b;
+};
+static const int max_occluders = 8;
+
+/*
+  Draws the children like draw_children(), except the parts of them that
+  are hidden under opaque children drawn after them. To keep this cheap,
+  only the max_occluders largest opaque children are looked at.
+*/
+void Fl_Group::draw_occluded_children() {
+  Fl_Widget*const* a = array();
+  Fl_Occluder occ[max_occluders];
+  int nocc = 0, i, k;
+  for (i = 0; i < children_; i++) { // find the largest opaque children
+    Fl_Widget& o = *a[i];
+    if (!o.visible() || o.type() >= FL_WINDOW || o.w() <= 0 || o.h() <= 0 ||
+        !fl_box_opaque(o.box())) continue;
+    long area = long(o.w()) * o.h();
+    if (nocc == max_occluders &&
+        area <= long(occ[nocc-1].r - occ[nocc-1].x) * (occ[nocc-1].b - occ[nocc-1].y)) continue;
+    k = nocc < max_occluders ? nocc++ : nocc - 1;
+    for (; k > 0 && area > long(occ[k-1].r - occ[k-1].x) * (occ[k-1].b - occ[k-1].y); k--)
+      occ[k] = occ[k-1];
+    occ[k].i = i;
+    occ[k].x = o.x(); occ[k].y = o.y();
+    occ[k].r = o.x() + o.w(); occ[k].b = o.y() + o.h();
+  }
+
+  int all = damage() & ~FL_DAMAGE_CHILD; // redraw the entire thing
+  // the clip only cuts the hidden sides of children, as some draw a little
+  // outside their bounding box, so it extends to the window on other sides:
+  Fl_Window *win = as_window() ? as_window() : window();
+  for (i = 0; i < children_; i++) {
+    Fl_Widget& o = *a[i];
+    // reduce x,y,r,b to the part of o that is not hidden, as long as
+    // an occluder hides a whole side of it:
+    int x = o.x(), y = o.y(), r = x + o.w(), b = y + o.h();
+    int changed = 1;
+    while (changed && x < r && y < b) {
+      changed = 0;
+      for (k = 0; k < nocc; k++) {
+        const Fl_Occluder& c = occ[k];
+        if (c.i <= i || c.x >= r || c.r <= x || c.y >= b || c.b <= y) continue;
+        if (c.x <= x && c.r >= r) {
+          if (c.y <= y) {y = c.b; changed = 1;}
+          else if (c.b >= b) {b = c.y; changed = 1;}
+        } else if (c.y <= y && c.b >= b) {
+          if (c.x <= x) {x = c.r; changed = 1;}
+          else if (c.r >= r) {r = c.x; changed = 1;}
+        }
+      }
+    }
+    if (x < r && y < b) {
+      int clip = win && (x != o.x() || y != o.y() || r != o.x() + o.w() || b != o.y() + o.h());
+      if (clip) {
+        if (x == o.x()) x = 0;
+        if (y == o.y()) y = 0;
+        if (r == o.x() + o.w()) r = win->w();
+        if (b == o.y() + o.h()) b = win->h();
+        fl_push_clip(x, y, r - x, b - y);
+      }
+      if (all) draw_child(o); else update_child(o);
+      if (clip) fl_pop_clip();
+    }
+    if (all) draw_outside_label(o);
+  }
+}
+
 void Fl_Group::draw() {
   if (damage() & ~FL_DAMAGE_CHILD) { // redraw the entire thing:
     draw_box();
@@ -822,6 +901,44 @@ void Fl_Group::draw() {
   draw_children();
 }
 
+/*
+  Draws a widget that has the CACHED flag by copying its offscreen copy,
+  after bringing the copy up to date with the damage of the widget.
+  The copy is made again if the widget or the display scale changed.
+  The copy is the widget's cache_, passed as \p c.
+  Returns 0 if the widget must be drawn directly, as when printing.
+*/
+static int draw_cached(Fl_Widget& widget, Fl_Widget_Cache *&c) {
+  if (Fl_Surface_Device::surface() != Fl_Display_Device::display_device() ||
+      widget.w() <= 0 || widget.h() <= 0) return 0;
+  float s = fl_graphics_driver->scale();
+  if (c && (c->w != widget.w() || c->h != widget.h() || c->scale != s)) {
+    delete c;
+    c = 0;
+  }
+  if (!c) {
+    c = new Fl_Widget_Cache(&widget, s);
+    if (!c->offscreen()) {
+      delete c;
+      c = 0;
+      return 0;
+    }
+    widget.clear_damage(FL_DAMAGE_ALL);
+  }
+  if (widget.damage()) {
+    Fl_Widget *o = widget.parent();
+    while (o && o->box() == FL_NO_BOX) o = o->parent();
+    Fl_Surface_Device::push_current(c);
+    if (widget.damage() & FL_DAMAGE_ALL)
+      fl_rectf(0, 0, c->w, c->h, o ? o->color() : FL_BACKGROUND_COLOR);
+    c->update();
+    Fl_Surface_Device::pop_current();
+  }
+  fl_copy_offscreen(widget.x(), widget.y(), c->w, c->h, c->offscreen(), 0, 0);
+  widget.clear_damage();
+  return 1;
+}
+
 /**
   Draws a child only if it needs it.
 
@@ -833,6 +950,7 @@ void Fl_Group::draw() {
 void Fl_Group::update_child(Fl_Widget& widget) const {
   if (widget.damage() && widget.visible() && widget.type() < FL_WINDOW &&
       fl_not_clipped(widget.x(), widget.y(), widget.w(), widget.h())) {
+    if (widget.cached() && draw_cached(widget, widget.cache_)) return;
     widget.draw();
     widget.clear_damage();
   }
@@ -843,10 +961,12 @@ void Fl_Group::update_child(Fl_Widget& widget) const {
 
   This draws a child widget, if it is not clipped.
   The damage bits are cleared after drawing.
+  A child that is cached() is copied from its offscreen image.
 */
 void Fl_Group::draw_child(Fl_Widget& widget) const {
   if (widget.visible() && widget.type() < FL_WINDOW &&
       fl_not_clipped(widget.x(), widget.y(), widget.w(), widget.h())) {
+    if (widget.cached() && draw_cached(widget, widget.cache_)) return;
     widget.clear_damage(FL_DAMAGE_ALL);
     widget.draw();
     widget.clear_damage();
@@ -23,6 +23,8 @@
 #include <FL/Fl_Menu_Item.H>
 #include <FL/Fl_Image.H>
 #include "flstring.h"
+#include "fl_pixel_ops.h"
+#include <math.h>
 
 void fl_restore_clip(); // from fl_rect.cxx
 
@@ -221,6 +223,13 @@ Fl_Image::measure(const Fl_Label *lo,		// I - Label
 
 /** Sets the RGB image scaling method used for copy(int, int).
     Applies to all RGB images, defaults to FL_RGB_SCALING_NEAREST.
+
+    FL_RGB_SCALING_NEAREST and FL_RGB_SCALING_BILINEAR are fast, but skip
+    source pixels when shrinking by large factors, which aliases. With
+    FL_RGB_SCALING_AREA and FL_RGB_SCALING_BICUBIC, each direction in which
+    the image shrinks is area-averaged, and each direction in which it grows
+    is interpolated bilinearly or bicubically. These are slower, so large
+    images are scaled by a pool of threads.
 */
 void Fl_Image::RGB_scaling(Fl_RGB_Scaling method) {
   RGB_scaling_ = method;
@@ -393,6 +402,421 @@ void Fl_RGB_Image::uncache() {
   Fl_Graphics_Driver::default_driver().uncache(this, id_, mask_);
 }
 
+//
+// Separable resampler used by Fl_RGB_Image::copy() for the
+// FL_RGB_SCALING_AREA and FL_RGB_SCALING_BICUBIC scaling methods...
+//
+// The image is scaled horizontally into a temporary image, which is then
+// scaled vertically. Each axis that shrinks is area-averaged (box filter),
+// each axis that grows is interpolated with a triangle (bilinear) or
+// Catmull-Rom (bicubic) filter. Filter weights are computed once per axis
+// as fixed-point integers, so the inner loops are plain integer
+// multiply-adds over contiguous bytes that compilers can vectorize.
+// Color channels of images with alpha are premultiplied while filtering.
+// Large images are scaled by a pool of threads, each doing a band of rows.
+//
+
+#if defined(FL_CFG_SYS_WIN32)
+#  include <windows.h>
+#  include <process.h>
+#  define FL_RESAMPLE_THREADS 1
+#elif defined(HAVE_PTHREAD)
+#  include <pthread.h>
+#  include <unistd.h>
+#  define FL_RESAMPLE_THREADS 1
+#endif
+
+#define FL_RESAMPLE_BITS	14		// fractional bits of filter weights
+#define FL_RESAMPLE_ONE		(1 << FL_RESAMPLE_BITS)
+#define FL_RESAMPLE_MAX_THREADS	8		// maximum number of threads
+#define FL_RESAMPLE_MIN_PIXELS	(256 * 1024)	// minimum pixels per thread
+
+// Filter weights for one axis: output pixel i is the weighted sum of the
+// input pixels start[i] ... start[i] + taps - 1.
+struct Fl_Resample_Axis {
+  int	*start;		// first input pixel of each output pixel
+  int	*weight;	// taps weights per output pixel, summing to FL_RESAMPLE_ONE
+  int	taps;		// number of input pixels per output pixel
+
+  Fl_Resample_Axis(int in, int out, Fl_RGB_Scaling method);
+  ~Fl_Resample_Axis() { delete[] start; delete[] weight; }
+};
+
+// Triangle (bilinear) filter...
+static double resample_triangle(double x) {
+  if (x < 0) x = -x;
+  return x < 1.0 ? 1.0 - x : 0.0;
+}
+
+// Catmull-Rom (bicubic) filter...
+static double resample_cubic(double x) {
+  if (x < 0) x = -x;
+  if (x < 1.0) return (1.5 * x - 2.5) * x * x + 1.0;
+  if (x < 2.0) return ((-0.5 * x + 2.5) * x - 4.0) * x + 2.0;
+  return 0.0;
+}
+
+Fl_Resample_Axis::Fl_Resample_Axis(int in, int out, Fl_RGB_Scaling method) {
+  double scale = (double)in / out;	// input pixels per output pixel
+  double support;			// filter radius in input pixels
+  double (*filter)(double) = 0;		// 0 for area averaging
+
+  if (out < in) support = scale / 2;
+  else if (method == FL_RGB_SCALING_BICUBIC) support = 2.0, filter = resample_cubic;
+  else support = 1.0, filter = resample_triangle;
+
+  // Number of input pixels that can fall into the filter...
+  taps   = filter ? (int)support * 2 : (int)ceil(support * 2) + 1;
+  if (taps > in) taps = in;
+  start  = new int[out];
+  weight = new int[out * taps];
+
+  double *f = new double[taps];
+  for (int i = 0; i < out; i ++) {
+    double center = (i + 0.5) * scale;	// position in input pixels
+    int first = (int)floor(filter ? center - support + 0.5 : center - support);
+    if (first < 0) first = 0;
+    if (first > in - taps) first = in - taps;
+
+    // Compute the weights and normalize them...
+    double total = 0.0;
+    for (int j = 0; j < taps; j ++) {
+      double x = first + j;
+      if (filter) f[j] = filter(x + 0.5 - center);
+      else {
+        // Area covered by input pixel x in the output pixel...
+        double l = center - support, r = center + support;
+        if (l < x) l = x;
+        if (r > x + 1) r = x + 1;
+        f[j] = r > l ? r - l : 0.0;
+      }
+      total += f[j];
+    }
+
+    int *w = weight + i * taps, sum = 0, big = 0;
+    for (int j = 0; j < taps; j ++) {
+      w[j] = (int)floor(f[j] / total * FL_RESAMPLE_ONE + 0.5);
+      sum += w[j];
+      if (w[j] > w[big]) big = j;
+    }
+    w[big] += FL_RESAMPLE_ONE - sum;	// make the weights sum up exactly
+    start[i] = first;
+  }
+  delete[] f;
+}
+
+// Scaling job for one band of rows...
+struct Fl_Resample_Job {
+  const uchar	*src;		// source image
+  int		src_ld;		// bytes from source row to source row
+  int		src_w;		// source width
+  uchar		*dst;		// destination image
+  int		dst_ld;		// bytes from destination row to destination row
+  int		w;		// destination width
+  int		d;		// channels
+  int		premul;		// premultiply alpha of the source?
+  int		unpremul;	// undo alpha premultiplication of the destination?
+  const Fl_Resample_Axis *axis;	// filter weights
+  void		(*func)(const Fl_Resample_Job *);
+  int		from, to;	// band of destination rows
+};
+
+static inline uchar resample_clamp(int v) {
+  v >>= FL_RESAMPLE_BITS;
+  return (uchar)(v < 0 ? 0 : v > 255 ? 255 : v);
+}
+
+// Divides the color channels of n pixels by alpha...
+static void resample_unpremul(uchar *p, int n, int d) {
+  for (uchar *end = p + n * d; p < end; p += d) {
+    int a = p[d - 1];
+    for (int c = 0; c < d - 1; c ++) {
+      if (!a) p[c] = 0;
+      else if (p[c] >= a) p[c] = 255;
+      else p[c] = (uchar)((p[c] * 255 + a / 2) / a);
+    }
+  }
+}
+
+// Scales one row horizontally. Inlined with constant d for each depth...
+static inline void resample_row(const uchar *src, uchar *dst, int w, int d,
+                                const Fl_Resample_Axis *axis) {
+  const int taps = axis->taps;
+  const int *wt = axis->weight;
+  for (int x = 0; x < w; x ++, wt += taps, dst += d) {
+    const uchar *s = src + axis->start[x] * d;
+    int a0 = FL_RESAMPLE_ONE / 2, a1 = a0, a2 = a0, a3 = a0;
+    for (int j = 0; j < taps; j ++, s += d) {
+      a0 += wt[j] * s[0];
+      if (d > 1) a1 += wt[j] * s[1];
+      if (d > 2) a2 += wt[j] * s[2];
+      if (d > 3) a3 += wt[j] * s[3];
+    }
+    dst[0] = resample_clamp(a0);
+    if (d > 1) dst[1] = resample_clamp(a1);
+    if (d > 2) dst[2] = resample_clamp(a2);
+    if (d > 3) dst[3] = resample_clamp(a3);
+  }
+}
+
+// Horizontal pass: scales rows from ... to - 1 of the source...
+static void resample_rows(const Fl_Resample_Job *job) {
+  const int d = job->d;
+  uchar *buf = job->premul ? new uchar[job->src_w * d] : 0;
+
+  for (int y = job->from; y < job->to; y ++) {
+    const uchar *src = job->src + y * job->src_ld;
+    uchar *dst = job->dst + y * job->dst_ld;
+    if (buf) {
+      fl_pixels_premul(src, buf, job->src_w, d);
+      src = buf;
+    }
+    switch (d) {
+      case 1 : resample_row(src, dst, job->w, 1, job->axis); break;
+      case 2 : resample_row(src, dst, job->w, 2, job->axis); break;
+      case 3 : resample_row(src, dst, job->w, 3, job->axis); break;
+      default : resample_row(src, dst, job->w, 4, job->axis); break;
+    }
+    if (job->unpremul) resample_unpremul(dst, job->w, d);
+  }
+  delete[] buf;
+}
+
+// Vertical pass: computes destination rows from ... to - 1...
+static void resample_columns(const Fl_Resample_Job *job) {
+  const int d = job->d, taps = job->axis->taps, n = job->w * d;
+  int *acc = new int[n];
+  uchar *buf = job->premul ? new uchar[n] : 0;
+
+  for (int y = job->from; y < job->to; y ++) {
+    const uchar *src = job->src + job->axis->start[y] * job->src_ld;
+    const int *w = job->axis->weight + y * taps;
+    uchar *dst = job->dst + y * job->dst_ld;
+    int i;
+
+    for (i = 0; i < n; i ++) acc[i] = FL_RESAMPLE_ONE / 2;
+    for (int j = 0; j < taps; j ++, src += job->src_ld) {
+      const uchar *s = src;
+      if (buf) {
+        fl_pixels_premul(src, buf, job->w, d);
+        s = buf;
+      }
+      const int wj = w[j];
+      for (i = 0; i < n; i ++) acc[i] += wj * s[i];
+    }
+    for (i = 0; i < n; i ++) dst[i] = resample_clamp(acc[i]);
+    if (job->unpremul) resample_unpremul(dst, job->w, d);
+  }
+  delete[] buf;
+  delete[] acc;
+}
+
+// Returns the number of processors...
+static int resample_cpus() {
+#if defined(FL_CFG_SYS_WIN32)
+  SYSTEM_INFO si;
+  GetSystemInfo(&si);
+  return (int)si.dwNumberOfProcessors;
+#elif defined(FL_RESAMPLE_THREADS) && defined(_SC_NPROCESSORS_ONLN)
+  return (int)sysconf(_SC_NPROCESSORS_ONLN);
+#else
+  return 1;
+#endif
+}
+
+#ifdef FL_RESAMPLE_THREADS
+
+// Persistent pool of resampling threads. The threads are started when a
+// large image is first scaled and then wait for bands of rows to scale.
+// One copy() at a time uses the pool, others scale in their own thread...
+static Fl_Resample_Job	resample_jobs[FL_RESAMPLE_MAX_THREADS];
+static int		resample_next = 0;	// next band for a pool thread
+static int		resample_count = 0;	// number of bands for the pool
+static int		resample_pending = 0;	// bands not scaled yet
+static int		resample_threads = 0;	// number of pool threads
+static int		resample_in_use = 0;	// is a copy() using the pool?
+
+#  if defined(FL_CFG_SYS_WIN32)
+
+// Windows threads: the bands are counted by a semaphore...
+static CRITICAL_SECTION	resample_cs;
+static HANDLE		resample_sem = 0;	// one count per band to scale
+static HANDLE		resample_done = 0;	// set when all bands are scaled
+
+static void resample_lock() {
+  if (!resample_sem) {
+    InitializeCriticalSection(&resample_cs);
+    resample_sem = CreateSemaphore(NULL, 0, 0x7fffffff, NULL);
+    resample_done = CreateEvent(NULL, FALSE, FALSE, NULL);
+  }
+  EnterCriticalSection(&resample_cs);
+}
+
+static void resample_unlock() {
+  LeaveCriticalSection(&resample_cs);
+}
+
+static unsigned __stdcall resample_thread(void *) {
+  for (;;) {
+    WaitForSingleObject(resample_sem, INFINITE);
+    resample_lock();
+    Fl_Resample_Job *job = resample_jobs + resample_next ++;
+    resample_unlock();
+    job->func(job);
+    resample_lock();
+    if (!--resample_pending) SetEvent(resample_done);
+    resample_unlock();
+  }
+  return 0;
+}
+
+static int resample_start_thread() {
+  HANDLE t = (HANDLE)_beginthreadex(NULL, 0, resample_thread, NULL, 0, NULL);
+  if (!t) return 0;
+  CloseHandle(t);
+  return 1;
+}
+
+// Hands bands 0 ... n - 1 of resample_jobs to the pool (lock held)...
+static void resample_post(int n) {
+  ReleaseSemaphore(resample_sem, n, NULL);
+}
+
+// Waits until the pool has scaled all bands...
+static void resample_wait() {
+  WaitForSingleObject(resample_done, INFINITE);
+  resample_lock();
+}
+
+#  else
+
+// POSIX threads...
+static pthread_mutex_t	resample_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t	resample_work = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t	resample_done = PTHREAD_COND_INITIALIZER;
+
+static void resample_lock() {
+  pthread_mutex_lock(&resample_mutex);
+}
+
+static void resample_unlock() {
+  pthread_mutex_unlock(&resample_mutex);
+}
+
+static void *resample_thread(void *) {
+  resample_lock();
+  for (;;) {
+    while (resample_next >= resample_count)
+      pthread_cond_wait(&resample_work, &resample_mutex);
+    Fl_Resample_Job *job = resample_jobs + resample_next ++;
+    resample_unlock();
+    job->func(job);
+    resample_lock();
+    if (!--resample_pending) pthread_cond_signal(&resample_done);
+  }
+  return 0;
+}
+
+static int resample_start_thread() {
+  pthread_t t;
+  if (pthread_create(&t, NULL, resample_thread, NULL)) return 0;
+  pthread_detach(t);
+  return 1;
+}
+
+static void resample_post(int) {
+  pthread_cond_broadcast(&resample_work);
+}
+
+static void resample_wait() {
+  resample_lock();
+  while (resample_pending) pthread_cond_wait(&resample_done, &resample_mutex);
+}
+
+#  endif // FL_CFG_SYS_WIN32
+#endif // FL_RESAMPLE_THREADS
+
+// Runs job->func for rows 0 ... rows - 1, split into bands for up to
+// 'threads' threads. The last band is done by the calling thread...
+static void resample_run(Fl_Resample_Job *job, int rows, int threads) {
+  if (threads > rows) threads = rows;
+  int n = 0;				// bands for the pool
+#ifdef FL_RESAMPLE_THREADS
+  if (threads > 1) {
+    resample_lock();
+    if (!resample_in_use) {
+      while (resample_threads < threads - 1 && resample_start_thread())
+        resample_threads ++;
+      n = resample_threads < threads - 1 ? resample_threads : threads - 1;
+    }
+    if (n) {
+      for (int i = 0; i < n; i ++) {
+        resample_jobs[i] = *job;
+        resample_jobs[i].from = rows * i / (n + 1);
+        resample_jobs[i].to = rows * (i + 1) / (n + 1);
+      }
+      resample_in_use = 1;
+      resample_next = 0;
+      resample_count = resample_pending = n;
+      resample_post(n);
+    }
+    resample_unlock();
+  }
+#endif // FL_RESAMPLE_THREADS
+  job->from = rows * n / (n + 1);
+  job->to = rows;
+  job->func(job);
+#ifdef FL_RESAMPLE_THREADS
+  if (n) {
+    resample_wait();
+    resample_next = resample_count = 0;
+    resample_in_use = 0;
+    resample_unlock();
+  }
+#endif // FL_RESAMPLE_THREADS
+}
+
+// Scales W0 x H0 x d image src with line size src_ld to W x H image dst.
+// The horizontal pass is the slower one, so it is done on the smaller
+// number of rows: first if the image grows vertically, else last...
+static void resample(const uchar *src, int W0, int H0, int d, int src_ld,
+                     uchar *dst, int W, int H, Fl_RGB_Scaling method) {
+  Fl_Resample_Axis xaxis(W0, W, method), yaxis(H0, H, method);
+  int rows_first = H > H0;
+  int tw = rows_first ? W : W0, th = rows_first ? H0 : H;
+  uchar *tmp = new uchar[tw * th * d];
+  int threads = 1;
+#ifdef FL_RESAMPLE_THREADS
+  threads = (W * H > W0 * H0 ? W * H : W0 * H0) / FL_RESAMPLE_MIN_PIXELS;
+  if (threads > 1) {
+    int cpus = resample_cpus();
+    if (threads > cpus) threads = cpus;
+    if (threads > FL_RESAMPLE_MAX_THREADS) threads = FL_RESAMPLE_MAX_THREADS;
+  }
+#endif // FL_RESAMPLE_THREADS
+
+  Fl_Resample_Job job;
+  job.d = d;
+  job.premul = !(d & 1);	// last channel is alpha
+  job.unpremul = 0;
+  job.src = src; job.src_ld = src_ld; job.src_w = W0;
+  job.dst = tmp; job.dst_ld = tw * d; job.w = tw;
+  job.axis = rows_first ? &xaxis : &yaxis;
+  job.func = rows_first ? resample_rows : resample_columns;
+  resample_run(&job, th, threads);
+
+  job.unpremul = job.premul;
+  job.premul = 0;
+  job.src = tmp; job.src_ld = tw * d; job.src_w = tw;
+  job.dst = dst; job.dst_ld = W * d; job.w = W;
+  job.axis = rows_first ? &yaxis : &xaxis;
+  job.func = rows_first ? resample_columns : resample_rows;
+  resample_run(&job, H, threads);
+
+  delete[] tmp;
+}
+
+
 Fl_Image *Fl_RGB_Image::copy(int W, int H) {
   Fl_RGB_Image	*new_image;	// New RGB image
   uchar		*new_array;	// New array for image data
@@ -474,7 +898,7 @@ Fl_Image *Fl_RGB_Image::copy(int W, int H) {
         sy ++;
       }
     }
-  } else {
+  } else if (Fl_Image::RGB_scaling() == FL_RGB_SCALING_BILINEAR) {
     // Bilinear scaling (FL_RGB_SCALING_BILINEAR)
     const float xscale = (data_w() - 1) / (float) W;
     const float yscale = (data_h() - 1) / (float) H;
@@ -536,6 +960,10 @@ Fl_Image *Fl_RGB_Image::copy(int W, int H) {
         }
       }
     }
+  } else {
+    // Area-averaged when shrinking, bilinear or bicubic when enlarging
+    resample(array, data_w(), data_h(), d(), line_d, new_array, W, H,
+             Fl_Image::RGB_scaling());
   }
 
   return new_image;
@@ -548,56 +976,38 @@ void Fl_RGB_Image::color_average(Fl_Color c, float i) {
   // Delete any existing pixmap/mask objects...
   uncache();
 
-  // Allocate memory as needed...
-  uchar		*new_array,
-		*new_ptr;
+  // Blend in place if we own the image data, else into a new array...
+  uchar		*new_array;
 
   if (!alloc_array) new_array = new uchar[h() * w() * d()];
   else new_array = (uchar *)array;
 
   // Get the color to blend with...
   uchar		r, g, b;
-  unsigned	ia, ir, ig, ib;
 
   Fl::get_color(c, r, g, b);
   if (i < 0.0f) i = 0.0f;
   else if (i > 1.0f) i = 1.0f;
 
-  ia = (unsigned)(256 * i);
-  ir = r * (256 - ia);
-  ig = g * (256 - ia);
-  ib = b * (256 - ia);
-
   // Update the image data to do the blend...
   const uchar	*old_ptr;
-  int		x, y;
-  int   line_i = ld() ? ld() - (w()*d()) : 0; // increment from line end to beginning of next line
-
-  if (d() < 3) {
-    ig = (r * 31 + g * 61 + b * 8) / 100 * (256 - ia);
+  uchar		*new_ptr;
+  int		y;
+  int		line_d = ld() ? ld() : w() * d();	// stride from line to line
 
-    for (new_ptr = new_array, old_ptr = array, y = 0; y < h(); y ++, old_ptr += line_i)
-      for (x = 0; x < w(); x ++) {
-	*new_ptr++ = (*old_ptr++ * ia + ig) >> 8;
-	if (d() > 1) *new_ptr++ = *old_ptr++;
-      }
-  } else {
-    for (new_ptr = new_array, old_ptr = array, y = 0; y < h(); y ++, old_ptr += line_i)
-      for (x = 0; x < w(); x ++) {
-	*new_ptr++ = (*old_ptr++ * ia + ir) >> 8;
-	*new_ptr++ = (*old_ptr++ * ia + ig) >> 8;
-	*new_ptr++ = (*old_ptr++ * ia + ib) >> 8;
-	if (d() > 3) *new_ptr++ = *old_ptr++;
-      }
-  }
+  if (line_d == w() * d())
+    fl_pixels_blend(array, new_array, w() * h(), d(), (unsigned)(256 * i), r, g, b);
+  else
+    for (new_ptr = new_array, old_ptr = array, y = 0; y < h();
+         y ++, old_ptr += line_d, new_ptr += w() * d())
+      fl_pixels_blend(old_ptr, new_ptr, w(), d(), (unsigned)(256 * i), r, g, b);
 
   // Set the new pointers/values as needed...
   if (!alloc_array) {
     array       = new_array;
     alloc_array = 1;
-
-    ld(0);
   }
+  ld(0);
 }
 
 void Fl_RGB_Image::desaturate() {
@@ -610,28 +1020,28 @@ void Fl_RGB_Image::desaturate() {
   // Delete any existing pixmap/mask objects...
   uncache();
 
-  // Allocate memory for a grayscale image...
+  // Convert in place if we own the image data, else into a new array...
   uchar		*new_array,
 		*new_ptr;
   int		new_d;
 
   new_d     = d() - 2;
-  new_array = new uchar[h() * w() * new_d];
+  if (!alloc_array) new_array = new uchar[h() * w() * new_d];
+  else new_array = (uchar *)array;
 
   // Copy the image data, converting to grayscale...
   const uchar	*old_ptr;
-  int		x, y;
-  int   line_i = ld() ? ld() - (w()*d()) : 0; // increment from line end to beginning of next line
+  int		y;
+  int		line_d = ld() ? ld() : w() * d();	// stride from line to line
 
-  for (new_ptr = new_array, old_ptr = array, y = 0; y < h(); y ++, old_ptr += line_i)
-    for (x = 0; x < w(); x ++, old_ptr += d()) {
-      *new_ptr++ = (uchar)((31 * old_ptr[0] + 61 * old_ptr[1] + 8 * old_ptr[2]) / 100);
-      if (d() > 3) *new_ptr++ = old_ptr[3];
-    }
-
-  // Free the old array as needed, and then set the new pointers/values...
-  if (alloc_array) delete[] (uchar *)array;
+  if (line_d == w() * d())
+    fl_pixels_gray(array, new_array, w() * h(), d());
+  else
+    for (new_ptr = new_array, old_ptr = array, y = 0; y < h();
+         y ++, old_ptr += line_d, new_ptr += w() * new_d)
+      fl_pixels_gray(old_ptr, new_ptr, w(), d());
 
+  // Set the new pointers/values...
   array       = new_array;
   alloc_array = 1;
 
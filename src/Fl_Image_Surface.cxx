@@ -41,6 +41,13 @@ Fl_Image_Surface::Fl_Image_Surface(int w, int h, int high_res, Fl_Offscreen off)
 }
 
 
+/** Constructor for derived classes that draw with their own platform surface */
+Fl_Image_Surface::Fl_Image_Surface(Fl_Image_Surface_Driver *surface) : Fl_Widget_Surface(NULL) {
+  platform_surface = surface;
+  if (platform_surface) driver(platform_surface->driver());
+}
+
+
 /** The destructor. */
 Fl_Image_Surface::~Fl_Image_Surface() { delete platform_surface; }
 
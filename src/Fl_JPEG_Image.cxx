@@ -33,6 +33,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <setjmp.h>
+#include "flstring.h"
 
 
 // Some releases of the Cygwin JPEG libraries don't have a correctly
@@ -98,104 +99,44 @@ extern "C" {
  */
 Fl_JPEG_Image::Fl_JPEG_Image(const char *filename)	// I - File to load
 : Fl_RGB_Image(0,0,0) {
-#ifdef HAVE_LIBJPEG
-  FILE				*fp;	// File pointer
-  jpeg_decompress_struct	dinfo;	// Decompressor info
-  fl_jpeg_error_mgr		jerr;	// Error handler info
-  JSAMPROW			row;	// Sample row pointer
-  
-  // the following variables are pointers allocating some private space that
-  // is not reset by 'setjmp()'
-  char* max_finish_decompress_err;      // count errors and give up afer a while
-  char* max_destroy_decompress_err;     // to avoid recusion and deadlock
-  
-  // Clear data...
-  alloc_array = 0;
-  array = (uchar *)0;
-  
-  // Open the image file...
-  if ((fp = fl_fopen(filename, "rb")) == NULL) {
-    ld(ERR_FILE_ACCESS);
-    return;
-  }
-  
-  // Setup the decompressor info and read the header...
-  dinfo.err                = jpeg_std_error((jpeg_error_mgr *)&jerr);
-  jerr.pub_.error_exit     = fl_jpeg_error_handler;
-  jerr.pub_.output_message = fl_jpeg_output_handler;
-  
-  // Setup error loop variables
-  max_finish_decompress_err = (char*)malloc(1);   // allocate space on the frame for error counters
-  max_destroy_decompress_err = (char*)malloc(1);  // otherwise, the variables are reset on the longjmp
-  *max_finish_decompress_err=10;
-  *max_destroy_decompress_err=10;
-  
-  if (setjmp(jerr.errhand_))
-  {
-    // JPEG error handling...
-    Fl::warning("JPEG file \"%s\" is too large or contains errors!\n", filename);
-    // if any of the cleanup routines hits another error, we would end up 
-    // in a loop. So instead, we decrement max_err for some upper cleanup limit.
-    if ( ((*max_finish_decompress_err)-- > 0) && array)
-      jpeg_finish_decompress(&dinfo);
-    if ( (*max_destroy_decompress_err)-- > 0)
-      jpeg_destroy_decompress(&dinfo);
-    
-    fclose(fp);
-    
-    w(0);
-    h(0);
-    d(0);
-    
-    if (array) {
-      delete[] (uchar *)array;
-      array = 0;
-      alloc_array = 0;
-    }
-    
-    free(max_destroy_decompress_err);
-    free(max_finish_decompress_err);
-    
-    ld(ERR_FORMAT);
-    return;
-  }
-  
-  jpeg_create_decompress(&dinfo);
-  jpeg_stdio_src(&dinfo, fp);
-  jpeg_read_header(&dinfo, TRUE);
-  
-  dinfo.quantize_colors      = (boolean)FALSE;
-  dinfo.out_color_space      = JCS_RGB;
-  dinfo.out_color_components = 3;
-  dinfo.output_components    = 3;
-  
-  jpeg_calc_output_dimensions(&dinfo);
-  
-  w(dinfo.output_width); 
-  h(dinfo.output_height);
-  d(dinfo.output_components);
-  
-  if (((size_t)w()) * h() * d() > max_size() ) longjmp(jerr.errhand_, 1);
-  array = new uchar[w() * h() * d()];
-  alloc_array = 1;
-  
-  jpeg_start_decompress(&dinfo);
-  
-  while (dinfo.output_scanline < dinfo.output_height) {
-    row = (JSAMPROW)(array +
-                     dinfo.output_scanline * dinfo.output_width *
-                     dinfo.output_components);
-    jpeg_read_scanlines(&dinfo, &row, (JDIMENSION)1);
-  }
-  
-  jpeg_finish_decompress(&dinfo);
-  jpeg_destroy_decompress(&dinfo);
-  
-  free(max_destroy_decompress_err);
-  free(max_finish_decompress_err);
-  
-  fclose(fp);
-#endif // HAVE_LIBJPEG
+  load_jpg_(filename, 0L, 0L);
+}
+
+
+/**
+ \brief The constructor loads the JPEG image from the given jpeg filename,
+ reduced to about the size \p W x \p H, and optionally progressively.
+
+ If \p W and \p H are not 0, the image is decoded directly at 1/2, 1/4
+ or 1/8 of its size, using the smallest of these scales that still gives
+ an image of at least \p W x \p H pixels (or at full size if it isn't
+ larger than that), and a faster but less accurate decoding method.
+ This is several times faster, and uses a fraction of the memory of
+ decoding the image at full size and then scaling it down with copy(),
+ which makes it well suited for thumbnails. The image keeps its aspect
+ ratio, so it is usually somewhat larger than requested: use scale()
+ or copy() to get the exact size.
+
+ If \p cb is not NULL and the file is a progressive JPEG, the image is
+ decoded progressively, and \p cb is called after each scan but the last
+ with the image decoded so far, e.g. to display it while loading a large
+ image over a slow connection. The callback may draw the image, e.g. by
+ redrawing a widget and calling Fl::check(), but must not delete it.
+ Note that decoding progressively is slower in total.
+
+ Use Fl_Image::fail() to check if Fl_JPEG_Image failed to load, as for
+ Fl_JPEG_Image(const char *filename).
+
+ \param[in] filename a full path and name pointing to a valid jpeg file.
+ \param[in] W, H the desired size, or 0 for the full size
+ \param[in] cb callback called after each intermediate scan, or NULL
+ \param[in] data user data passed to \p cb
+ \since FLTK 1.4.0
+ */
+Fl_JPEG_Image::Fl_JPEG_Image(const char *filename, int W, int H,
+                             Fl_JPEG_Progress_Callback *cb, void *data)
+: Fl_RGB_Image(0,0,0) {
+  load_jpg_(filename, 0L, 0L, W, H, cb, data);
 }
 
 
@@ -293,7 +234,20 @@ static void jpeg_mem_src(j_decompress_ptr cinfo, const unsigned char *data)
  */
 Fl_JPEG_Image::Fl_JPEG_Image(const char *name, const unsigned char *data)
 : Fl_RGB_Image(0,0,0) {
+  load_jpg_(0L, name, data);
+}
+
+
+// Load a JPEG image from a file or from memory (if filename is NULL),
+// reduced to at least W x H if W and H are set, calling cb after each
+// intermediate scan of a progressive JPEG if cb is set. If sharename is
+// set, the image is added to the shared images by that name.
+void Fl_JPEG_Image::load_jpg_(const char *filename, const char *sharename,
+                              const unsigned char *data, int W, int H,
+                              Fl_JPEG_Progress_Callback *cb, void *cbdata)
+{
 #ifdef HAVE_LIBJPEG
+  FILE				*fp = 0;	// File pointer
   jpeg_decompress_struct	dinfo;	// Decompressor info
   fl_jpeg_error_mgr		jerr;	// Error handler info
   JSAMPROW			row;	// Sample row pointer
@@ -307,6 +261,14 @@ Fl_JPEG_Image::Fl_JPEG_Image(const char *name, const unsigned char *data)
   alloc_array = 0;
   array = (uchar *)0;
   
+  // Open the image file...
+  if (filename) {
+    if ((fp = fl_fopen(filename, "rb")) == NULL) {
+      ld(ERR_FILE_ACCESS);
+      return;
+    }
+  }
+  
   // Setup the decompressor info and read the header...
   dinfo.err                = jpeg_std_error((jpeg_error_mgr *)&jerr);
   jerr.pub_.error_exit     = fl_jpeg_error_handler;
@@ -321,7 +283,10 @@ Fl_JPEG_Image::Fl_JPEG_Image(const char *name, const unsigned char *data)
   if (setjmp(jerr.errhand_))
   {
     // JPEG error handling...
-    Fl::warning("JPEG data is too large or contains errors!\n");
+    if (filename)
+      Fl::warning("JPEG file \"%s\" is too large or contains errors!\n", filename);
+    else
+      Fl::warning("JPEG data is too large or contains errors!\n");
     // if any of the cleanup routines hits another error, we would end up 
     // in a loop. So instead, we decrement max_err for some upper cleanup limit.
     if ( ((*max_finish_decompress_err)-- > 0) && array)
@@ -329,6 +294,8 @@ Fl_JPEG_Image::Fl_JPEG_Image(const char *name, const unsigned char *data)
     if ( (*max_destroy_decompress_err)-- > 0)
       jpeg_destroy_decompress(&dinfo);
     
+    if (fp) fclose(fp);
+    
     w(0);
     h(0);
     d(0);
@@ -342,17 +309,37 @@ Fl_JPEG_Image::Fl_JPEG_Image(const char *name, const unsigned char *data)
     free(max_destroy_decompress_err);
     free(max_finish_decompress_err);
     
+    if (filename) ld(ERR_FORMAT);
     return;
   }
   
   jpeg_create_decompress(&dinfo);
-  jpeg_mem_src(&dinfo, data);
+  if (fp) jpeg_stdio_src(&dinfo, fp);
+  else jpeg_mem_src(&dinfo, data);
   jpeg_read_header(&dinfo, TRUE);
   
   dinfo.quantize_colors      = (boolean)FALSE;
   dinfo.out_color_space      = JCS_RGB;
   dinfo.out_color_components = 3;
   dinfo.output_components    = 3;
+
+  if (W > 0 && H > 0) {
+    // Let the decoder scale the image down by 1/2, 1/4 or 1/8 while it
+    // does the inverse DCT, as long as the result isn't smaller than W x H
+    unsigned denom = 1;
+    while (denom < 8 &&
+           (dinfo.image_width  + 2 * denom - 1) / (2 * denom) >= (unsigned)W &&
+           (dinfo.image_height + 2 * denom - 1) / (2 * denom) >= (unsigned)H)
+      denom *= 2;
+    dinfo.scale_num   = 1;
+    dinfo.scale_denom = denom;
+    // Thumbnails don't need the most accurate decoding
+    dinfo.dct_method          = JDCT_IFAST;
+    dinfo.do_fancy_upsampling = (boolean)FALSE;
+  }
+
+  if (cb && jpeg_has_multiple_scans(&dinfo))
+    dinfo.buffered_image = (boolean)TRUE;	// decode progressively
   
   jpeg_calc_output_dimensions(&dinfo);
   
@@ -365,12 +352,31 @@ Fl_JPEG_Image::Fl_JPEG_Image(const char *name, const unsigned char *data)
   alloc_array = 1;
   
   jpeg_start_decompress(&dinfo);
-  
-  while (dinfo.output_scanline < dinfo.output_height) {
-    row = (JSAMPROW)(array +
-                     dinfo.output_scanline * dinfo.output_width *
-                     dinfo.output_components);
-    jpeg_read_scanlines(&dinfo, &row, (JDIMENSION)1);
+
+  if (dinfo.buffered_image) {
+    // Output each scan as it comes in, the last one being the final image
+    memset((void *)array, 0, w() * h() * d());
+    for (int scan = 1; ; scan ++) {
+      jpeg_start_output(&dinfo, dinfo.input_scan_number);
+      while (dinfo.output_scanline < dinfo.output_height) {
+        row = (JSAMPROW)(array +
+                         dinfo.output_scanline * dinfo.output_width *
+                         dinfo.output_components);
+        jpeg_read_scanlines(&dinfo, &row, (JDIMENSION)1);
+      }
+      jpeg_finish_output(&dinfo);
+      if (jpeg_input_complete(&dinfo)) break;
+      uncache();			// the image data changed
+      cb(this, scan, cbdata);
+    }
+    uncache();
+  } else {
+    while (dinfo.output_scanline < dinfo.output_height) {
+      row = (JSAMPROW)(array +
+                       dinfo.output_scanline * dinfo.output_width *
+                       dinfo.output_components);
+      jpeg_read_scanlines(&dinfo, &row, (JDIMENSION)1);
+    }
   }
   
   jpeg_finish_decompress(&dinfo);
@@ -379,8 +385,10 @@ Fl_JPEG_Image::Fl_JPEG_Image(const char *name, const unsigned char *data)
   free(max_destroy_decompress_err);
   free(max_finish_decompress_err);
 
-  if (w() && h() && name) {
-    Fl_Shared_Image *si = new Fl_Shared_Image(name, this);
+  if (fp) fclose(fp);
+
+  if (w() && h() && sharename) {
+    Fl_Shared_Image *si = new Fl_Shared_Image(sharename, this);
     si->add();
   }
 #endif // HAVE_LIBJPEG
@@ -311,6 +311,13 @@ int Fl_Native_File_Chooser_FLTK_Driver::exist_dialog() {
   return fl_choice("%s", fl_cancel, fl_ok, NULL, Fl_Native_File_Chooser::file_exists_message);
 }
 
+#if defined(USE_HEADLESS)
+// the headless platform has no native file chooser
+Fl_Native_File_Chooser::Fl_Native_File_Chooser(int val) {
+  platform_fnfc = new Fl_Native_File_Chooser_FLTK_Driver(val);
+}
+#endif // USE_HEADLESS
+
 /**
  \}
  \endcond
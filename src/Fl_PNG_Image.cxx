@@ -34,6 +34,7 @@
 #include <FL/Fl_PNG_Image.H>
 #include <FL/Fl_Shared_Image.H>
 #include <FL/fl_utf8.h>
+#include "flstring.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -103,30 +104,100 @@ Fl_PNG_Image::Fl_PNG_Image (const char *filename): Fl_RGB_Image(0,0,0)
 
  \param name_png  A name given to this image or NULL
  \param buffer	  Pointer to the start of the PNG image in memory
- \param maxsize   Size in bytes of the memory buffer containing the PNG image
+ \param datasize  Size in bytes of the memory buffer containing the PNG image
  */
 Fl_PNG_Image::Fl_PNG_Image (
-      const char *name_png, const unsigned char *buffer, int maxsize): Fl_RGB_Image(0,0,0)
+      const char *name_png, const unsigned char *buffer, int datasize): Fl_RGB_Image(0,0,0)
 {
-  load_png_(name_png, buffer, maxsize);
+  load_png_(name_png, buffer, datasize);
 }
 
 
-void Fl_PNG_Image::load_png_(const char *name_png, const unsigned char *buffer_png, int maxsize)
+/**
+ \brief Constructor that decodes a PNG image file row by row.
+
+ This constructor reads the image like Fl_PNG_Image(const char*), but
+ calls \p cb while it decodes, so that large images can be shown
+ progressively, and it can decode a horizontal strip of the image only.
+
+ \p cb is called once with \p row set to NULL, \p y set to -1 and \p pass
+ set to the number of interlace passes (1 or 7) as soon as the header has
+ been read. At this point w(), h() and d() give the size of the whole PNG
+ image. The callback may then point \c img->array to a buffer of its own
+ of at least w() * d() bytes per decoded row, and set \c img->alloc_array
+ to 0, to have the rows decoded directly into that buffer.
+
+ After that \p cb is called for each decoded row with a pointer to the row
+ in the image data, the number of the row in the PNG image and the
+ interlace pass, starting at 0. Interlaced images are decoded with
+ libpng's "rectangle" effect, i.e. each pass fills in all rows with
+ a coarser version of the image, and the callback is called for all rows
+ in each pass.
+
+ If \p cb returns non-zero, decoding stops and the image keeps the rows
+ decoded so far, the others are black (or transparent). If it returns
+ non-zero for the header, the image is not decoded and fail() returns
+ ERR_NO_IMAGE.
+
+ \p Y and \p H select rows \p Y to \p Y + \p H - 1 of the PNG image; the
+ resulting image has only these rows. Rows below the strip are not read
+ from the file. \p H < 0 selects all rows from \p Y to the bottom.
+
+ \param[in] filename Name of PNG file to read
+ \param[in] cb       Function called with each decoded row, or NULL
+ \param[in] data     User data passed to \p cb
+ \param[in] Y, H     First row and number of rows to decode
+ \since FLTK 1.4.0
+ */
+Fl_PNG_Image::Fl_PNG_Image(const char *filename, Fl_PNG_Row_Callback *cb,
+                           void *data, int Y, int H)
+: Fl_RGB_Image(0,0,0)
+{
+  load_png_(filename, NULL, 0, cb, data, Y, H);
+}
+
+
+/**
+ \brief Constructor that decodes a PNG image from memory row by row.
+
+ Like Fl_PNG_Image(const char*, Fl_PNG_Row_Callback*, void*, int, int), but
+ reads the PNG data directly from \p buffer, which must stay valid until the
+ constructor returns. If \p name_png is given and the whole image was decoded,
+ it is added to the list of shared images.
+
+ \param[in] name_png A name given to this image or NULL
+ \param[in] buffer   Pointer to the start of the PNG image in memory
+ \param[in] datasize Size in bytes of the memory buffer containing the PNG image
+ \param[in] cb       Function called with each decoded row, or NULL
+ \param[in] data     User data passed to \p cb
+ \param[in] Y, H     First row and number of rows to decode
+ \since FLTK 1.4.0
+ */
+Fl_PNG_Image::Fl_PNG_Image(const char *name_png, const unsigned char *buffer,
+                           int datasize, Fl_PNG_Row_Callback *cb, void *data,
+                           int Y, int H)
+: Fl_RGB_Image(0,0,0)
+{
+  load_png_(name_png, buffer, datasize, cb, data, Y, H);
+}
+
+
+void Fl_PNG_Image::load_png_(const char *name_png, const unsigned char *buffer_png, int datasize,
+                             Fl_PNG_Row_Callback *cb, void *cbdata, int Y, int H)
 {
 #if defined(HAVE_LIBPNG) && defined(HAVE_LIBZ)
-  int i;		// Looping var
+  int i, y;		// Looping vars
   int channels;		// Number of color channels
   png_structp pp;	// PNG read pointer
   png_infop info = 0;	// PNG info pointers
-  png_bytep *rows;	// PNG row pointers
   fl_png_memory png_mem_data;
   int from_memory = (buffer_png != NULL); // true if reading image from memory
 
-  // Note: The file pointer fp must not be an automatic (stack) variable
-  // to avoid potential clobbering by setjmp/longjmp (gcc: [-Wclobbered]).
-  static FILE *fp;	// intentionally initialized separately below
-  fp = NULL;		// always initialize file pointer
+  // Note: Variables that are changed after setjmp() and used after longjmp()
+  // must be volatile to avoid clobbering (gcc: [-Wclobbered]). They must
+  // not be static either, since images may be loaded in several threads.
+  FILE * volatile fp = NULL;
+  uchar * volatile scratch = NULL; // receives rows outside of [Y, Y+H)
 
   if (!from_memory) {
     if ((fp = fl_fopen(name_png, "rb")) == NULL) {
@@ -150,6 +221,7 @@ void Fl_PNG_Image::load_png_(const char *name_png, const unsigned char *buffer_p
   if (setjmp(png_jmpbuf(pp))) {
     png_destroy_read_struct(&pp, &info, NULL);
     if (!from_memory) fclose(fp);
+    delete[] scratch;
     Fl::warning("PNG file or data \"%s\" is too large or contains errors!\n", display_name);
     w(0); h(0); d(0); ld(ERR_FORMAT);
     return;
@@ -157,7 +229,7 @@ void Fl_PNG_Image::load_png_(const char *name_png, const unsigned char *buffer_p
 
   if (from_memory) {
     png_mem_data.current = buffer_png;
-    png_mem_data.last = buffer_png + maxsize;
+    png_mem_data.last = buffer_png + datasize;
     png_mem_data.pp = pp;
     // Initialize the function pointer to the PNG read "engine"...
     png_set_read_fn (pp, (png_voidp) &png_mem_data, png_read_data_from_mem);
@@ -181,8 +253,9 @@ void Fl_PNG_Image::load_png_(const char *name_png, const unsigned char *buffer_p
   if ((png_get_color_type(pp, info) & PNG_COLOR_MASK_ALPHA) || (num_trans != 0))
     channels ++;
 
+  int png_h = (int)png_get_image_height(pp, info);
   w((int)(png_get_image_width(pp, info)));
-  h((int)(png_get_image_height(pp, info)));
+  h(png_h);
   d(channels);
 
   if (png_get_bit_depth(pp, info) < 8)
@@ -199,30 +272,57 @@ void Fl_PNG_Image::load_png_(const char *name_png, const unsigned char *buffer_p
     png_set_tRNS_to_alpha(pp);
 #  endif // HAVE_PNG_GET_VALID && HAVE_PNG_SET_TRNS_TO_ALPHA
 
-  if (((size_t)w()) * h() * d() > max_size() ) longjmp(png_jmpbuf(pp), 1);
-  array = new uchar[w() * h() * d()];
-  alloc_array = 1;
-
-  // Allocate pointers...
-  rows = new png_bytep[h()];
+  int passes = png_set_interlace_handling(pp);
 
-  for (i = 0; i < h(); i ++)
-    rows[i] = (png_bytep)(array + i * w() * d());
+  // Clip the requested strip to the image...
+  if (Y < 0) Y = 0;
+  if (Y > png_h) Y = png_h;
+  if (H < 0 || H > png_h - Y) H = png_h - Y;
 
-  // Read the image, handling interlacing as needed...
-  for (i = png_set_interlace_handling(pp); i > 0; i --)
-    png_read_rows(pp, rows, NULL, h());
+  if (cb && cb(this, NULL, -1, passes, cbdata)) {
+    png_destroy_read_struct(&pp, &info, NULL);
+    if (!from_memory) fclose(fp);
+    w(0); h(0); d(0); ld(ERR_NO_IMAGE);
+    return;
+  }
 
-  if (channels == 4) Fl::system_driver()->png_extra_rgba_processing((uchar*)array, w(), h());
+  h(H);
+  int rowbytes = w() * d();	// bytes per row
+  if (((size_t)w()) * h() * d() > max_size() ) longjmp(png_jmpbuf(pp), 1);
+  if (!array) {		// the callback may have set its own buffer
+    array = new uchar[rowbytes * h()];
+    alloc_array = 1;
+  }
+  uchar *pixels = (uchar *)array;
+  if (cb || passes > 1) memset(pixels, 0, rowbytes * h());
+  if (Y > 0 || Y + H < png_h) scratch = new uchar[rowbytes];
+
+  // Read the image one row at a time, handling interlacing as needed. Rows
+  // above the strip are decoded into the scratch row. In the last pass rows
+  // below the strip are not read at all.
+  int stopped = 0;
+  for (i = 0; i < passes && !stopped; i ++) {
+    int last = (i == passes - 1) ? Y + H : png_h;
+    for (y = 0; y < last; y ++) {
+      uchar *row = (y >= Y && y < Y + H) ? pixels + (y - Y) * rowbytes : scratch;
+      if (passes > 1 && cb) png_read_row(pp, NULL, row); // "rectangle" effect
+      else png_read_row(pp, row, NULL);
+      if (row == scratch) continue;
+      // (done again on each pass, so that the callback gets finished rows)
+      if (channels == 4)
+        Fl::system_driver()->png_extra_rgba_processing(row, w(), 1);
+      if (cb && cb(this, row, y, i, cbdata)) { stopped = 1; break; }
+    }
+  }
 
   // Free memory and return...
-  delete[] rows;
+  delete[] scratch;
 
-  png_read_end(pp, info);
+  if (!stopped && Y + H == png_h) png_read_end(pp, info);
   png_destroy_read_struct(&pp, &info, NULL);
 
   if (from_memory) {
-    if (w() && h() && name_png) {
+    if (w() && h() && name_png && !stopped && h() == png_h) {
       Fl_Shared_Image *si = new Fl_Shared_Image(name_png, this);
       si->add();
     }
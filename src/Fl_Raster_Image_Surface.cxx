@@ -0,0 +1,41 @@
+//
+// "$Id$"
+//
+// Draw-to-memory code for the Fast Light Tool Kit (FLTK).
+//
+// Copyright 1998-2018 by Bill Spitzak and others.
+//
+// This library is free software. Distribution and use rights are outlined in
+// the file "COPYING" which should have been included with this file.  If this
+// file is missing or damaged, see the license at:
+//
+//     http://www.fltk.org/COPYING.php
+//
+// Please report all bugs and problems on the following page:
+//
+//     http://www.fltk.org/str.php
+//
+
+#include <FL/Fl_Raster_Image_Surface.H>
+#include "drivers/Raster/Fl_Raster_Image_Surface_Driver.H"
+#include "drivers/Raster/Fl_Raster_Graphics_Driver.H"
+
+/** Creates a surface of \p w x \p h pixels */
+Fl_Raster_Image_Surface::Fl_Raster_Image_Surface(int w, int h) :
+  Fl_Image_Surface(new Fl_Raster_Image_Surface_Driver(w, h)) {
+}
+
+/** Sets whether shapes, lines and text are antialiased.
+ Antialiasing is off by default, which makes the drawings pixel-exact. */
+void Fl_Raster_Image_Surface::antialias(int on) {
+  ((Fl_Raster_Graphics_Driver*)driver())->antialias(on);
+}
+
+/** Returns whether shapes, lines and text are antialiased */
+int Fl_Raster_Image_Surface::antialias() {
+  return ((Fl_Raster_Graphics_Driver*)driver())->antialias();
+}
+
+//
+// End of "$Id$".
+//
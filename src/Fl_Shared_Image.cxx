@@ -16,6 +16,7 @@
 //     http://www.fltk.org/str.php
 //
 
+#include "config_lib.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <FL/fl_utf8.h>
@@ -40,17 +41,45 @@ Fl_Shared_Handler *Fl_Shared_Image::handlers_ = 0;// Additional format handlers
 int	Fl_Shared_Image::num_handlers_ = 0;	// Number of format handlers
 int	Fl_Shared_Image::alloc_handlers_ = 0;	// Allocated format handlers
 
-
 //
-// Typedef the C API sort function type the only way I know how...
+// The cache index: a hash table of the images in images_[] by name,
+// and a list of the released images kept in the cache, least recently
+// used first...
 //
 
-extern "C" {
-  typedef int (*compare_func_t)(const void *, const void *);
+static Fl_Shared_Image **hash_table = 0;	// Hash buckets
+static int	hash_size = 0;			// Number of buckets (power of 2)
+static Fl_Shared_Image *lru_first = 0;		// Least recently used unused image
+static Fl_Shared_Image *lru_last = 0;		// Most recently used unused image
+static size_t	lru_bytes = 0;			// Memory used by unused images
+static size_t	cache_max_bytes = 0;		// Memory budget for unused images
+static unsigned long cache_hits = 0;		// find()/get() found the image
+static unsigned long cache_misses = 0;		// find()/get() didn't
+
+
+// Hash an image name (FNV-1a)...
+static unsigned hash_name(const char *name) {
+  unsigned h = 2166136261U;
+  for (; *name; name ++) {
+    h ^= (uchar)*name;
+    h *= 16777619U;
+  }
+  return h;
+}
+
+
+// Estimate the memory used by an image...
+static size_t image_bytes(Fl_Shared_Image *img) {
+  int d = img->d();
+  return (size_t)img->w() * img->h() * (d > 0 ? d : 1);
 }
 
 
-/** Returns the Fl_Shared_Image* array */
+/** Returns the Fl_Shared_Image* array.
+  The images are in no particular order. The array includes the released
+  images kept in the cache (see cache_size()), which have a refcount()
+  of 0.
+*/
 Fl_Shared_Image **Fl_Shared_Image::images() {
   return images_;
 }
@@ -78,11 +107,8 @@ int Fl_Shared_Image::num_images() {
   An image is marked \p original if it was directly loaded from a file or
   from memory as opposed to copied and resized images.
 
-  This comparison is used in Fl_Shared_Image::find() to find an image that
-  matches the requested one or to find the position where a new image
-  should be entered into the sorted list of shared images.
-
-  It is usually used in two steps:
+  Fl_Shared_Image::find() matches images the same way, to find an image
+  that matches the requested one. It is usually done in two steps:
 
     -# search with exact width and height
     -# if not found, search again with width = 0 (and height = 0)
@@ -123,6 +149,11 @@ Fl_Shared_Image::Fl_Shared_Image() : Fl_Image(0,0,0) {
   original_    = 0;
   image_       = 0;
   alloc_image_ = 0;
+  index_       = -1;
+  hash_next_   = 0;
+  lru_prev_    = 0;
+  lru_next_    = 0;
+  lru_bytes_   = 0;
 }
 
 
@@ -143,6 +174,11 @@ Fl_Shared_Image::Fl_Shared_Image(const char *n,		// I - Filename
   image_       = img;
   alloc_image_ = !img;
   original_    = 1;
+  index_       = -1;
+  hash_next_   = 0;
+  lru_prev_    = 0;
+  lru_next_    = 0;
+  lru_bytes_   = 0;
 
   if (!img) reload();
   else update();
@@ -152,35 +188,85 @@ Fl_Shared_Image::Fl_Shared_Image(const char *n,		// I - Filename
 /**
   Adds a shared image to the image cache.
 
-  This \b protected method adds an image to the cache, an ordered list
-  of shared images. The cache is searched for a matching image whenever
-  one is requested, for instance with Fl_Shared_Image::get() or
+  This \b protected method adds an image to the cache, a hash table
+  of shared images by name. The cache is searched for a matching image
+  whenever one is requested, for instance with Fl_Shared_Image::get() or
   Fl_Shared_Image::find().
 */
 void
 Fl_Shared_Image::add() {
-  Fl_Shared_Image	**temp;		// New image pointer array...
+  if (index_ >= 0) return;		// Already cached
 
   if (num_images_ >= alloc_images_) {
     // Allocate more memory...
-    temp = new Fl_Shared_Image *[alloc_images_ + 32];
+    int newalloc = alloc_images_ ? alloc_images_ * 2 : 32;
+    Fl_Shared_Image **temp = new Fl_Shared_Image *[newalloc];
 
     if (alloc_images_) {
-      memcpy(temp, images_, alloc_images_ * sizeof(Fl_Shared_Image *));
+      memcpy(temp, images_, num_images_ * sizeof(Fl_Shared_Image *));
 
       delete[] images_;
     }
 
     images_       = temp;
-    alloc_images_ += 32;
+    alloc_images_ = newalloc;
   }
 
+  index_ = num_images_;
   images_[num_images_] = this;
   num_images_ ++;
 
-  if (num_images_ > 1) {
-    qsort(images_, num_images_, sizeof(Fl_Shared_Image *),
-          (compare_func_t)compare);
+  if (num_images_ > hash_size) {
+    // Grow the hash table, keeping at most one image per bucket on average...
+    int newsize = hash_size ? hash_size * 2 : 64;
+    Fl_Shared_Image **temp = new Fl_Shared_Image *[newsize];
+    memset(temp, 0, newsize * sizeof(Fl_Shared_Image *));
+
+    for (int i = 0; i < num_images_ - 1; i ++) {
+      Fl_Shared_Image *img = images_[i];
+      unsigned bucket = hash_name(img->name_) & (newsize - 1);
+      img->hash_next_ = temp[bucket];
+      temp[bucket] = img;
+    }
+
+    delete[] hash_table;
+    hash_table = temp;
+    hash_size  = newsize;
+  }
+
+  unsigned bucket = hash_name(name_) & (hash_size - 1);
+  hash_next_ = hash_table[bucket];
+  hash_table[bucket] = this;
+}
+
+
+// Remove an image from the image cache (the image is not deleted)...
+void
+Fl_Shared_Image::remove() {
+  if (index_ < 0) return;		// Not cached
+
+  // Unlink from hash bucket...
+  Fl_Shared_Image **p = hash_table + (hash_name(name_) & (hash_size - 1));
+  while (*p != this) p = &(*p)->hash_next_;
+  *p = hash_next_;
+  hash_next_ = 0;
+
+  // Fill the hole in images_[] with the last image...
+  num_images_ --;
+  if (index_ < num_images_) {
+    images_[index_] = images_[num_images_];
+    images_[index_]->index_ = index_;
+  }
+  index_ = -1;
+
+  if (num_images_ == 0) {
+    delete[] images_;
+    images_       = 0;
+    alloc_images_ = 0;
+
+    delete[] hash_table;
+    hash_table = 0;
+    hash_size  = 0;
   }
 }
 
@@ -215,69 +301,145 @@ Fl_Shared_Image::~Fl_Shared_Image() {
 /**
   Releases and possibly destroys (if refcount <= 0) a shared image.
 
-  In the latter case, it will reorganize the shared image array
-  so that no hole will occur.
+  If a memory budget for released images is set with cache_size(), an
+  image with refcount 0 is kept in the cache, and only destroyed when
+  released images that were used more recently need the memory.
 */
 void Fl_Shared_Image::release() {
-  int	i;	// Looping var...
-
   refcount_ --;
   if (refcount_ > 0) return;
 
-  for (i = 0; i < num_images_; i ++)
-    if (images_[i] == this) {
-      num_images_ --;
+  if (cache_max_bytes && index_ >= 0 && image_ && alloc_image_) {
+    // Keep the image as the most recently used unused image...
+    lru_prev_  = lru_last;
+    lru_next_  = 0;
+    if (lru_last) lru_last->lru_next_ = this;
+    else lru_first = this;
+    lru_last   = this;
+    lru_bytes_ = image_bytes(this);
+    lru_bytes  += lru_bytes_;
+
+    trim_cache();
+    return;
+  }
 
-      if (i < num_images_) {
-        memmove(images_ + i, images_ + i + 1,
-               (num_images_ - i) * sizeof(Fl_Shared_Image *));
-      }
+  remove();
+  delete this;
+}
 
-      break;
-    }
 
-  delete this;
+// Destroy the least recently used unused images until they fit in the
+// memory budget...
+void Fl_Shared_Image::trim_cache() {
+  while (lru_first && lru_bytes > cache_max_bytes) {
+    Fl_Shared_Image *img = lru_first;
 
-  if (num_images_ == 0 && images_) {
-    delete[] images_;
+    lru_first = img->lru_next_;
+    if (lru_first) lru_first->lru_prev_ = 0;
+    else lru_last = 0;
+    lru_bytes -= img->lru_bytes_;
 
-    images_       = 0;
-    alloc_images_ = 0;
+    img->remove();
+    delete img;
   }
 }
 
 
-/** Reloads the shared image from disk. */
-void Fl_Shared_Image::reload() {
-  // Load image from disk...
+/**
+  Sets the memory budget for released images kept in the cache.
+
+  By default (0), an image is destroyed as soon as it is released by all
+  its users, and loaded again if it is used again. Otherwise, released
+  images are kept in the cache until the memory they use exceeds \p bytes,
+  and then the least recently used ones are destroyed. Only images that
+  own their data (e.g. loaded from files) are kept.
+
+  The memory used by an image is estimated as w() * h() * d() bytes.
+
+  \param[in] bytes	the memory budget in bytes, or 0 to disable
+  \see cache_stats()
+  \since FLTK 1.4.0
+*/
+void Fl_Shared_Image::cache_size(size_t bytes) {
+  cache_max_bytes = bytes;
+  trim_cache();
+}
+
+
+/** Returns the memory budget for released images kept in the cache.
+  \see cache_size(size_t)
+  \since FLTK 1.4.0
+*/
+size_t Fl_Shared_Image::cache_size() {
+  return cache_max_bytes;
+}
+
+
+/**
+  Returns statistics of the image cache.
+
+  \param[out] hits	number of find() and get() calls that found the
+			requested image in the cache
+  \param[out] misses	number of find() and get() calls that didn't, and
+			for get() had to load or resize the image
+  \param[out] bytes	estimated memory used by all cached images
+  \param[out] unused_bytes estimated memory used by released images that
+			are kept in the cache (see cache_size())
+  \since FLTK 1.4.0
+*/
+void Fl_Shared_Image::cache_stats(unsigned long &hits, unsigned long &misses,
+                                  size_t &bytes, size_t &unused_bytes) {
+  hits         = cache_hits;
+  misses       = cache_misses;
+  unused_bytes = lru_bytes;
+  bytes        = 0;
+  for (int i = 0; i < num_images_; i ++)
+    bytes += image_bytes(images_[i]);
+}
+
+
+// Load an image file with the format handlers, without using the cache.
+// This is also used by the threads of get_async()...
+Fl_Image *Fl_Shared_Image::load(const char *name) {
   int		i;		// Looping var
   FILE		*fp;		// File pointer
   uchar		header[64];	// Buffer for auto-detecting files
   Fl_Image	*img;		// New image
 
-  if (!name_) return;
-
-  if ((fp = fl_fopen(name_, "rb")) != NULL) {
+  if ((fp = fl_fopen(name, "rb")) != NULL) {
     if (fread(header, 1, sizeof(header), fp)==0) { /* ignore */ }
     fclose(fp);
   } else {
-    return;
+    return 0;
   }
 
   // Load the image as appropriate...
   if (memcmp(header, "#define", 7) == 0) // XBM file
-    img = new Fl_XBM_Image(name_);
+    img = new Fl_XBM_Image(name);
   else if (memcmp(header, "/* XPM */", 9) == 0) // XPM file
-    img = new Fl_XPM_Image(name_);
+    img = new Fl_XPM_Image(name);
   else {
     // Not a standard format; try an image handler...
     for (i = 0, img = 0; i < num_handlers_; i ++) {
-      img = (handlers_[i])(name_, header, sizeof(header));
+      img = (handlers_[i])(name, header, sizeof(header));
 
       if (img) break;
     }
   }
 
+  return img;
+}
+
+
+/** Reloads the shared image from disk. */
+void Fl_Shared_Image::reload() {
+  // Load image from disk...
+  Fl_Image	*img;		// New image
+
+  if (!name_) return;
+
+  img = load(name_);
+
   if (img) {
     if (alloc_image_) delete image_;
 
@@ -383,9 +545,44 @@ void Fl_Shared_Image::uncache()
 
 
 
+// Find an image in the cache without counting hits or misses...
+Fl_Shared_Image* Fl_Shared_Image::lookup(const char *name, int W, int H) {
+  if (!num_images_) return 0;
+
+  Fl_Shared_Image *match = 0;
+
+  for (Fl_Shared_Image *img = hash_table[hash_name(name) & (hash_size - 1)];
+       img; img = img->hash_next_) {
+    if (strcmp(img->name_, name)) continue;
+    if ((W == 0 && img->original_) || (img->w() == W && img->h() == H)) {
+      match = img;
+      break;
+    }
+  }
+
+  if (!match) return 0;
+
+  if (match->refcount_ == 0) {
+    // Reuse a released image: no longer unused...
+    if (match->lru_prev_) match->lru_prev_->lru_next_ = match->lru_next_;
+    else lru_first = match->lru_next_;
+    if (match->lru_next_) match->lru_next_->lru_prev_ = match->lru_prev_;
+    else lru_last = match->lru_prev_;
+    match->lru_prev_ = match->lru_next_ = 0;
+    lru_bytes -= match->lru_bytes_;
+  }
+
+  match->refcount_ ++;
+  return match;
+}
+
+
+static Fl_Shared_Image *finish_loading(Fl_Shared_Image *img);
+
+
 /** Finds a shared image from its name and size specifications.
 
-  This uses a binary search in the image cache.
+  This uses a hash table lookup in the image cache.
 
   If the image \p name exists with the exact width \p W and height \p H,
   then it is returned.
@@ -396,31 +593,18 @@ void Fl_Shared_Image::uncache()
   In either case the refcount of the returned image is increased.
   The found image should be released with Fl_Shared_Image::release()
   when no longer needed.
+
+  If the image is still being loaded by get_async(), this waits until it
+  is loaded, and calls the callbacks of get_async() before it returns.
+  NULL is returned if loading failed.
 */
 Fl_Shared_Image* Fl_Shared_Image::find(const char *name, int W, int H) {
-  Fl_Shared_Image	*key,		// Image key
-			**match;	// Matching image
-
-  if (num_images_) {
-    key = new Fl_Shared_Image();
-    key->name_ = new char[strlen(name) + 1];
-    strcpy((char *)key->name_, name);
-    key->w(W);
-    key->h(H);
+  Fl_Shared_Image *img = finish_loading(lookup(name, W, H));
 
-    match = (Fl_Shared_Image **)bsearch(&key, images_, num_images_,
-                                        sizeof(Fl_Shared_Image *),
-                                        (compare_func_t)compare);
+  if (img) cache_hits ++;
+  else cache_misses ++;
 
-    delete key;
-
-    if (match) {
-      (*match)->refcount_ ++;
-      return *match;
-    }
-  }
-
-  return 0;
+  return img;
 }
 
 
@@ -449,6 +633,9 @@ Fl_Shared_Image* Fl_Shared_Image::find(const char *name, int W, int H) {
   Shared JPEG and PNG images can also be created from memory by using their
   named memory access constructor.
 
+  If the image is still being loaded by get_async(), this waits until it
+  is loaded, and calls the callbacks of get_async() before it returns.
+
   You should release() the image when you're done with it.
 
   \param name name of the image
@@ -462,9 +649,14 @@ Fl_Shared_Image* Fl_Shared_Image::find(const char *name, int W, int H) {
 Fl_Shared_Image* Fl_Shared_Image::get(const char *name, int W, int H) {
   Fl_Shared_Image	*temp;		// Image
 
-  if ((temp = find(name, W, H)) != NULL) return temp;
+  if ((temp = finish_loading(lookup(name, W, H))) != NULL) {
+    cache_hits ++;
+    return temp;
+  }
 
-  if ((temp = find(name)) == NULL) {
+  cache_misses ++;
+
+  if ((temp = finish_loading(lookup(name, 0, 0))) == NULL) {
     temp = new Fl_Shared_Image(name);
 
     if (!temp->image_) {
@@ -500,6 +692,617 @@ Fl_Shared_Image *Fl_Shared_Image::get(Fl_RGB_Image *rgb, int own_it)
 }
 
 
+//
+// Asynchronous loading for Fl_Shared_Image::get_async()...
+//
+// Requests are queued for a small pool of loader threads, which decode
+// (and resize) the image files. Finished requests are queued back to the
+// main thread, which is woken with Fl::awake() to put the images into
+// their shared images and call the callbacks. Everything but decoding
+// happens in the main thread, so the cache needs no locking.
+//
+
+#if defined(FL_CFG_SYS_WIN32)
+#  include <windows.h>
+#  include <process.h>
+#  define FL_ASYNC_THREADS 1
+#elif defined(HAVE_PTHREAD)
+#  include <pthread.h>
+#  define FL_ASYNC_THREADS 1
+#endif
+
+// A callback waiting for a request...
+struct Fl_Shared_Image_Waiter {
+  Fl_Shared_Image_Callback *cb;		// Callback
+  void			*data;		// Callback data
+  Fl_Shared_Image	*image;		// Image, for callbacks of cached images
+  Fl_Shared_Image_Waiter *next;		// Next waiter
+};
+
+// A request to load an image, and the machinery to do it...
+class Fl_Shared_Image_Loader {
+  Fl_Shared_Image	*shared_;	// Image to load (holds a reference)
+  char			*name_;		// Image file
+  int			w_, h_;		// Requested size, or 0
+  Fl_Image		*image_;	// Loaded image, or 0 if failed
+  Fl_Image		*original_;	// Original image if resized, else 0
+  int			main_thread_;	// Loaded by a timeout in the main thread?
+  Fl_Shared_Image_Waiter *waiters_;	// Callbacks to call when done
+  Fl_Shared_Image_Loader *next_;	// Next in queue
+  Fl_Shared_Image_Loader *next_pending_; // Next in list of all requests
+
+  static Fl_Shared_Image_Loader *pending_; // All requests (main thread only)
+  static Fl_Shared_Image_Loader *queue_first_, *queue_last_; // Requests to load
+  static Fl_Shared_Image_Loader *done_;	// Loaded requests
+  static int		threads_;	// Number of loader threads
+  static int		idle_threads_;	// Number of threads waiting for requests
+  static int		stop_;		// Threads exit when the queue is empty
+
+  void add_waiter(Fl_Shared_Image_Callback *cb, void *data);
+  void decode();
+  void load();
+  void finish();
+  static Fl_Shared_Image_Loader *find(Fl_Shared_Image *img);
+  static void push(Fl_Shared_Image_Loader *r);
+  static void loaded(Fl_Shared_Image_Loader *r);
+  static void done_cb(void *);
+  static void notify_cb(void *w);
+  static void notify(Fl_Shared_Image *img, Fl_Shared_Image_Callback *cb, void *data);
+#ifdef FL_ASYNC_THREADS
+  static void lock();
+  static void unlock();
+  static Fl_Shared_Image_Loader *pop();
+  static void start_thread();
+  static void join_threads();
+  static void signal_done();
+  static void wait_done();
+#  if defined(FL_CFG_SYS_WIN32)
+  static unsigned __stdcall thread_func(void *);
+#  else
+  static void *thread_func(void *);
+#  endif
+#endif // FL_ASYNC_THREADS
+  static void load_cb(void *r);
+
+public:
+  static Fl_Shared_Image *get(const char *name, int W, int H,
+                              Fl_Shared_Image_Callback *cb, void *data);
+  static int wait(Fl_Shared_Image *img);
+  static void stop();
+};
+
+Fl_Shared_Image_Loader *Fl_Shared_Image_Loader::pending_ = 0;
+Fl_Shared_Image_Loader *Fl_Shared_Image_Loader::queue_first_ = 0;
+Fl_Shared_Image_Loader *Fl_Shared_Image_Loader::queue_last_ = 0;
+Fl_Shared_Image_Loader *Fl_Shared_Image_Loader::done_ = 0;
+int Fl_Shared_Image_Loader::threads_ = 0;
+int Fl_Shared_Image_Loader::idle_threads_ = 0;
+int Fl_Shared_Image_Loader::stop_ = 0;
+
+#define FL_ASYNC_MAX_THREADS 4	// Maximum number of loader threads
+
+
+#if defined(FL_CFG_SYS_WIN32)
+
+// Windows threads: the number of queued requests is counted by a semaphore,
+// and loaded requests are signaled with an auto-reset event...
+static CRITICAL_SECTION	async_cs;
+static HANDLE		async_sem = 0;
+static HANDLE		async_done = 0;
+static HANDLE		async_threads[FL_ASYNC_MAX_THREADS];
+
+void Fl_Shared_Image_Loader::lock() {
+  if (!async_sem) {
+    InitializeCriticalSection(&async_cs);
+    async_sem  = CreateSemaphore(NULL, 0, 0x7fffffff, NULL);
+    async_done = CreateEvent(NULL, FALSE, FALSE, NULL);
+  }
+  EnterCriticalSection(&async_cs);
+}
+
+void Fl_Shared_Image_Loader::unlock() {
+  LeaveCriticalSection(&async_cs);
+}
+
+// Return the next request, or 0 if the thread should exit...
+Fl_Shared_Image_Loader *Fl_Shared_Image_Loader::pop() {
+  for (;;) {
+    lock();
+    idle_threads_ ++;
+    unlock();
+    WaitForSingleObject(async_sem, INFINITE);
+    lock();
+    idle_threads_ --;
+    Fl_Shared_Image_Loader *r = queue_first_;	// (0 if taken by wait())
+    if (r) queue_first_ = r->next_;
+    if (!queue_first_) queue_last_ = 0;
+    int exit = !r && stop_;
+    unlock();
+    if (r || exit) return r;
+  }
+}
+
+void Fl_Shared_Image_Loader::start_thread() {
+  HANDLE t = (HANDLE)_beginthreadex(NULL, 0, thread_func, NULL, 0, NULL);
+  if (t) async_threads[threads_ ++] = t;
+}
+
+// Wake all threads, wait until they have exited (in the main thread)...
+void Fl_Shared_Image_Loader::join_threads() {
+  lock();
+  stop_ = 1;
+  unlock();
+  ReleaseSemaphore(async_sem, threads_, NULL);
+  WaitForMultipleObjects(threads_, async_threads, TRUE, INFINITE);
+  for (int i = 0; i < threads_; i ++) CloseHandle(async_threads[i]);
+}
+
+void Fl_Shared_Image_Loader::signal_done() {
+  SetEvent(async_done);
+}
+
+// Wait for a thread to finish a request (called and returns locked)...
+void Fl_Shared_Image_Loader::wait_done() {
+  unlock();
+  WaitForSingleObject(async_done, INFINITE);
+  lock();
+}
+
+unsigned __stdcall Fl_Shared_Image_Loader::thread_func(void *) {
+  Fl_Shared_Image_Loader *r;
+  while ((r = pop()) != NULL) r->load();
+  return 0;
+}
+
+#elif defined(FL_ASYNC_THREADS)
+
+// POSIX threads...
+static pthread_mutex_t	async_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t	async_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t	async_done = PTHREAD_COND_INITIALIZER;
+static pthread_t	async_threads[FL_ASYNC_MAX_THREADS];
+
+void Fl_Shared_Image_Loader::lock() {
+  pthread_mutex_lock(&async_mutex);
+}
+
+void Fl_Shared_Image_Loader::unlock() {
+  pthread_mutex_unlock(&async_mutex);
+}
+
+// Return the next request, or 0 if the thread should exit...
+Fl_Shared_Image_Loader *Fl_Shared_Image_Loader::pop() {
+  lock();
+  idle_threads_ ++;
+  while (!queue_first_ && !stop_) pthread_cond_wait(&async_cond, &async_mutex);
+  idle_threads_ --;
+  Fl_Shared_Image_Loader *r = queue_first_;
+  if (r) queue_first_ = r->next_;
+  if (!queue_first_) queue_last_ = 0;
+  unlock();
+  return r;
+}
+
+void Fl_Shared_Image_Loader::start_thread() {
+  if (pthread_create(&async_threads[threads_], NULL, thread_func, NULL) == 0)
+    threads_ ++;
+}
+
+// Wake all threads, wait until they have exited (in the main thread)...
+void Fl_Shared_Image_Loader::join_threads() {
+  lock();
+  stop_ = 1;
+  pthread_cond_broadcast(&async_cond);
+  unlock();
+  for (int i = 0; i < threads_; i ++) pthread_join(async_threads[i], NULL);
+}
+
+void Fl_Shared_Image_Loader::signal_done() {
+  pthread_cond_broadcast(&async_done);
+}
+
+// Wait for a thread to finish a request (called and returns locked)...
+void Fl_Shared_Image_Loader::wait_done() {
+  pthread_cond_wait(&async_done, &async_mutex);
+}
+
+void *Fl_Shared_Image_Loader::thread_func(void *) {
+  Fl_Shared_Image_Loader *r;
+  while ((r = pop()) != NULL) r->load();
+  return 0;
+}
+
+#endif // FL_CFG_SYS_WIN32
+
+
+// Queue a request for loading...
+void Fl_Shared_Image_Loader::push(Fl_Shared_Image_Loader *r) {
+  r->main_thread_ = 0;
+#ifdef FL_ASYNC_THREADS
+  r->next_ = 0;
+  lock();
+  if (queue_last_) queue_last_->next_ = r;
+  else queue_first_ = r;
+  queue_last_ = r;
+  if (!idle_threads_ && threads_ < FL_ASYNC_MAX_THREADS) start_thread();
+  unlock();
+#  if defined(FL_CFG_SYS_WIN32)
+  ReleaseSemaphore(async_sem, 1, NULL);
+#  else
+  pthread_cond_signal(&async_cond);
+#  endif
+  if (threads_) return;
+  // No threads could be started: load the image in the main thread below...
+  lock();
+  queue_first_ = queue_last_ = 0;
+  unlock();
+#endif // FL_ASYNC_THREADS
+  // Load the image in the main thread, but later, one image at a time
+  r->main_thread_ = 1;
+  Fl::add_timeout(0.0, load_cb, r);
+}
+
+
+// Timeout callback to load an image without threads...
+void Fl_Shared_Image_Loader::load_cb(void *r) {
+  ((Fl_Shared_Image_Loader *)r)->load();
+}
+
+
+// Decode (and resize) the image of a request...
+void Fl_Shared_Image_Loader::decode() {
+  image_    = Fl_Shared_Image::load(name_);
+  original_ = 0;
+
+  if (image_ && w_ && h_ && (image_->w() != w_ || image_->h() != h_)) {
+    original_ = image_;
+    image_    = original_->copy(w_, h_);
+  }
+}
+
+
+// Load the image of a request (in a loader thread)...
+void Fl_Shared_Image_Loader::load() {
+  decode();
+  loaded(this);
+}
+
+
+// Queue a loaded request for the main thread...
+void Fl_Shared_Image_Loader::loaded(Fl_Shared_Image_Loader *r) {
+#ifdef FL_ASYNC_THREADS
+  if (r->main_thread_) {		// Loaded in the main thread
+    r->finish();
+    return;
+  }
+  lock();
+  int wake = !done_;
+  r->next_ = done_;
+  done_    = r;
+  signal_done();
+  unlock();
+  // Wake the main thread once for all requests that are done meanwhile
+  if (wake) Fl::awake(done_cb, 0);
+#else
+  r->finish();
+#endif // FL_ASYNC_THREADS
+}
+
+
+// Awake callback to finish loaded requests (in the main thread)...
+void Fl_Shared_Image_Loader::done_cb(void *) {
+#ifdef FL_ASYNC_THREADS
+  // Finish the requests in the order they were loaded, one at a time,
+  // since a callback may wait() for another one...
+  for (;;) {
+    lock();
+    Fl_Shared_Image_Loader **p = &done_;
+    if (*p) while ((*p)->next_) p = &(*p)->next_;
+    Fl_Shared_Image_Loader *r = *p;
+    *p = 0;
+    unlock();
+    if (!r) break;
+    r->finish();
+  }
+#endif // FL_ASYNC_THREADS
+}
+
+
+// Wait until the request loading an image, if any, is done, and finish it
+// (in the main thread). Returns 1 if the image was being loaded...
+int Fl_Shared_Image_Loader::wait(Fl_Shared_Image *img) {
+  Fl_Shared_Image_Loader *r = find(img);
+  if (!r) return 0;
+
+  if (r->main_thread_) {
+    // Not loaded yet by its timeout: load it now
+    Fl::remove_timeout(load_cb, r);
+    r->decode();
+    r->finish();
+    return 1;
+  }
+
+#ifdef FL_ASYNC_THREADS
+  Fl_Shared_Image_Loader **p;
+  lock();
+  for (p = &queue_first_; *p && *p != r; p = &(*p)->next_) {/*empty*/}
+  if (*p) {
+    // Not taken by a thread yet: load it here
+    *p = r->next_;
+    if (queue_last_ == r) {
+      queue_last_ = 0;
+      for (Fl_Shared_Image_Loader *q = queue_first_; q; q = q->next_) queue_last_ = q;
+    }
+    unlock();
+    r->decode();
+    r->finish();
+    return 1;
+  }
+  // Being loaded by a thread: wait until it's done
+  for (;;) {
+    for (p = &done_; *p && *p != r; p = &(*p)->next_) {/*empty*/}
+    if (*p) break;
+    wait_done();
+  }
+  *p = r->next_;
+  unlock();
+  r->finish();
+#endif // FL_ASYNC_THREADS
+  return 1;
+}
+
+
+// Finish all requests and stop the loader threads (in the main thread)...
+void Fl_Shared_Image_Loader::stop() {
+#ifdef FL_ASYNC_THREADS
+  if (threads_) {
+    join_threads();			// (after they emptied the queue)
+    lock();
+    threads_ = idle_threads_ = 0;
+    stop_ = 0;
+    unlock();
+    done_cb(0);
+  }
+#endif // FL_ASYNC_THREADS
+  // Requests loaded in the main thread
+  while (pending_) wait(pending_->shared_);
+}
+
+
+// Put the loaded image into its shared image and call the callbacks
+// (in the main thread)...
+void Fl_Shared_Image_Loader::finish() {
+  Fl_Shared_Image_Loader **p = &pending_;
+  while (*p != this) p = &(*p)->next_pending_;
+  *p = next_pending_;
+
+  Fl_Shared_Image *shared = shared_;
+
+  if (image_) {
+    if (original_) {
+      // Cache the original image too, like Fl_Shared_Image::get()...
+      Fl_Shared_Image *orig = Fl_Shared_Image::lookup(name_, 0, 0);
+      if (orig) {
+        delete original_;
+        orig->release();
+      } else {
+        orig = new Fl_Shared_Image(name_, original_);
+        orig->alloc_image_ = 1;
+        orig->add();
+      }
+    }
+
+    shared->image_       = image_;
+    shared->alloc_image_ = 1;
+    shared->update();
+  } else {
+    // Failed: remove it from the cache, so that it may be tried again
+    shared->remove();
+  }
+
+  while (waiters_) {
+    Fl_Shared_Image_Waiter *w = waiters_;
+    waiters_ = w->next;
+    if (w->cb) (w->cb)(shared, w->data);
+    delete w;
+  }
+
+  delete[] name_;
+  delete this;
+
+  shared->release();	// The request's reference
+}
+
+
+// Add a callback to a request, in the order of the get_async() calls...
+void Fl_Shared_Image_Loader::add_waiter(Fl_Shared_Image_Callback *cb, void *data) {
+  Fl_Shared_Image_Waiter *w = new Fl_Shared_Image_Waiter;
+  w->cb    = cb;
+  w->data  = data;
+  w->image = 0;
+  w->next  = 0;
+
+  Fl_Shared_Image_Waiter **p = &waiters_;
+  while (*p) p = &(*p)->next;
+  *p = w;
+}
+
+
+// Find the request loading an image, if any...
+Fl_Shared_Image_Loader *Fl_Shared_Image_Loader::find(Fl_Shared_Image *img) {
+  Fl_Shared_Image_Loader *r;
+  for (r = pending_; r; r = r->next_pending_)
+    if (r->shared_ == img) break;
+  return r;
+}
+
+
+// Timeout callback to call the callback for an image that was cached...
+void Fl_Shared_Image_Loader::notify_cb(void *v) {
+  Fl_Shared_Image_Waiter *w = (Fl_Shared_Image_Waiter *)v;
+  Fl_Shared_Image *img = w->image;
+  (w->cb)(img, w->data);
+  delete w;
+  img->release();
+}
+
+
+// Call the callback for an image that was cached, from the event loop,
+// as if it had been loaded...
+void Fl_Shared_Image_Loader::notify(Fl_Shared_Image *img,
+                                   Fl_Shared_Image_Callback *cb, void *data) {
+  if (!cb) return;
+  Fl_Shared_Image_Waiter *w = new Fl_Shared_Image_Waiter;
+  w->cb    = cb;
+  w->data  = data;
+  w->image = img;
+  w->next  = 0;
+  img->refcount_ ++;				// Keep the image until then
+  Fl::add_timeout(0.0, notify_cb, w);
+}
+
+
+Fl_Shared_Image *Fl_Shared_Image_Loader::get(const char *name, int W, int H,
+                                             Fl_Shared_Image_Callback *cb,
+                                             void *data) {
+  Fl_Shared_Image *img;
+
+  if (!W || !H) W = H = 0;		// Like get(): resize only if both are set
+
+  if ((img = Fl_Shared_Image::lookup(name, W, H)) != NULL) {
+    cache_hits ++;
+
+    Fl_Shared_Image_Loader *r = find(img);
+    if (r) r->add_waiter(cb, data);	// Still loading: wait for it
+    else notify(img, cb, data);
+
+    return img;
+  }
+
+  cache_misses ++;
+
+  if (W && (img = Fl_Shared_Image::lookup(name, 0, 0)) != NULL) {
+    if (!find(img)) {
+      // The original image is loaded: just resize it, like get()
+      Fl_Shared_Image *temp = (Fl_Shared_Image *)img->copy(W, H);
+      temp->add();
+      img->release();
+      notify(temp, cb, data);
+      return temp;
+    }
+
+    img->release();			// Still loading: load resized copy too
+  }
+
+  // Make sure the system driver exists before the threads use it...
+  Fl::system_driver();
+
+  // Add an empty shared image to the cache, to be filled in when loaded...
+  img = new Fl_Shared_Image();
+  img->name_ = new char[strlen(name) + 1];
+  strcpy((char *)img->name_, name);
+  img->w(W);
+  img->h(H);
+  img->original_ = !W;
+  img->add();
+  img->refcount_ ++;			// The request's reference
+
+  Fl_Shared_Image_Loader *r = new Fl_Shared_Image_Loader;
+  r->shared_   = img;
+  r->name_     = new char[strlen(name) + 1];
+  strcpy(r->name_, name);
+  r->w_        = W;
+  r->h_        = H;
+  r->image_    = 0;
+  r->original_ = 0;
+  r->waiters_  = 0;
+  r->next_     = 0;
+  r->add_waiter(cb, data);
+  r->next_pending_ = pending_;
+  pending_ = r;
+
+  push(r);
+
+  return img;
+}
+
+
+// Wait for an image found in the cache to be loaded, if get_async() is
+// still loading it. Returns the image, or NULL (and releases it) if
+// loading failed...
+static Fl_Shared_Image *finish_loading(Fl_Shared_Image *img) {
+  if (img && Fl_Shared_Image_Loader::wait(img) && img->fail()) {
+    img->release();
+    return NULL;
+  }
+  return img;
+}
+
+
+/**
+  Find or load an image in the background.
+
+  This works like get(const char *name, int W, int H), but if the image
+  isn't in the cache, it is loaded (and resized) by a pool of threads,
+  without blocking the calling thread. It returns a shared image right
+  away, which has no image data (and draws as an empty box of size
+  \p W x \p H, if given) until the image is loaded.
+
+  When the image has been loaded, the shared image is updated and
+  \p cb is called with the shared image and \p data, typically to
+  redraw the widgets that show it. \p cb is also called, from the event
+  loop, if the image was already in the cache. If loading fails, the
+  image's fail() method returns non-zero.
+
+  Concurrent requests for the same image (and size) share one loading
+  thread, and all their callbacks are called when it is done.
+
+  This must be called from the main thread, which must have called
+  Fl::lock() before (see \ref advanced_multithreading), since the
+  threads use Fl::awake() to hand the images back. The image format
+  handlers (see add_handler() and fl_register_images()) must be
+  registered before, and must be able to load different files in
+  different threads, like the ones of the fltk_images library. On
+  platforms without threads, the images are loaded in the main thread,
+  one image per event loop iteration.
+
+  get() and find() wait for images that are still being loaded. Call
+  stop_async() to wait for all of them and stop the loading threads,
+  e.g. before the program exits.
+
+  As for get(), you should release() the image when you're done with it.
+
+  \param[in] name name of the image
+  \param[in] W, H desired size, or 0 for the original size
+  \param[in] cb	callback called when the image is loaded, or NULL
+  \param[in] data user data passed to \p cb
+
+  \see Fl_Shared_Image::get(const char *name, int W, int H)
+  \since FLTK 1.4.0
+*/
+Fl_Shared_Image *Fl_Shared_Image::get_async(const char *name, int W, int H,
+                                            Fl_Shared_Image_Callback *cb,
+                                            void *data) {
+  return Fl_Shared_Image_Loader::get(name, W, H, cb, data);
+}
+
+
+/**
+  Waits for all images requested with get_async() and stops its threads.
+
+  This loads the images that are still queued, puts them into their
+  shared images and calls their callbacks, then stops the loading threads
+  and waits until they have exited. Call this (from the main thread)
+  before the program exits, or before the image format handlers go away.
+  Later calls of get_async() start new threads.
+
+  \since FLTK 1.4.0
+*/
+void Fl_Shared_Image::stop_async() {
+  Fl_Shared_Image_Loader::stop();
+}
+
+
 /** Adds a shared image handler, which is basically a test function
     for adding new formats.
 */
@@ -20,6 +20,7 @@
 #include <FL/Fl_Table.H>
 
 #include <FL/Fl.H>
+#include <FL/Fl_Image_Surface.H>
 #include <FL/fl_draw.H>
 
 #include <sys/types.h>
@@ -48,6 +49,272 @@ void Fl_Table::IntVector::size(unsigned int count) {
   }
 }
 
+// Row heights / column widths with prefix sums (private to Fl_Table)
+//
+//    In sparse mode only rows/cols whose size differs from 'dflt' are
+//    stored, sorted by number in 'index' with their size in 'sizes'.
+//    The scroll position of row x is then x * dflt plus the sum of the
+//    differences of the customized rows above x.
+//
+//    'sums' is a Fenwick (binary indexed) tree over the dense sizes, or
+//    over the differences in sparse mode: sums[i] holds the total of
+//    entries (i - (i & -i)) .. (i-1), so prefix sums are found and
+//    updated in O(log n). The tree is built lazily when first needed.
+
+// Sparse mode: return position of the first entry in 'index' >= x
+int Fl_Table::SizeVector::lookup(int x) {
+  int lo = 0, hi = (int)index.size();
+  while ( lo < hi ) {
+    int mid = (lo + hi) / 2;
+    if ( index[mid] < x ) lo = mid + 1;
+    else hi = mid;
+  }
+  return(lo);
+}
+
+// Sparse mode: insert size 'val' for row/col 'x' at position 'pos'
+void Fl_Table::SizeVector::insert(int pos, int x, int val) {
+  int n = (int)index.size();
+  index.size(n+1);
+  sizes.size(n+1);
+  for ( int i = n; i > pos; i-- ) {
+    index[i] = index[i-1];
+    sizes[i] = sizes[i-1];
+  }
+  index[pos] = x;
+  sizes[pos] = val;
+  free_sums();					// rebuilt on demand
+}
+
+// Sparse mode: remove entry at position 'pos'
+void Fl_Table::SizeVector::remove(int pos) {
+  int n = (int)index.size();
+  for ( int i = pos; i < n-1; i++ ) {
+    index[i] = index[i+1];
+    sizes[i] = sizes[i+1];
+  }
+  index.size(n-1);
+  sizes.size(n-1);
+  free_sums();					// rebuilt on demand
+}
+
+// Switch from sparse to dense storage
+void Fl_Table::SizeVector::make_dense() {
+  if ( !sparse ) return;
+  IntVector all;
+  all.size(count);
+  int n = (int)index.size();
+  for ( int x = 0, pos = 0; x < count; x++ ) {
+    all[x] = ( pos < n && index[pos] == x ) ? sizes[pos++] : dflt;
+  }
+  index.size(0);
+  sizes.size(count);
+  for ( int x = 0; x < count; x++ ) sizes[x] = all[x];
+  sparse = 0;
+  free_sums();					// rebuilt on demand
+}
+
+void Fl_Table::SizeVector::free_sums() {
+  if (sums)
+    free(sums);
+  sums = 0;
+}
+
+void Fl_Table::SizeVector::build_sums() {
+  int n = (int)sizes.size();
+  sums = (long*)malloc((n + 1) * sizeof(long));
+  sums[0] = 0;
+  for ( int i = 1; i <= n; i++ ) sums[i] = sparse ? sizes[i-1] - dflt : sizes[i-1];
+  // O(n) construction: push each partial sum up to its parent
+  for ( int i = 1; i <= n; i++ ) {
+    int parent = i + (i & -i);
+    if ( parent <= n ) sums[parent] += sums[i];
+  }
+}
+
+// Add 'delta' to entry 'pos' of the prefix sums (if built)
+void Fl_Table::SizeVector::add_sums(int pos, int delta) {
+  if ( !sums ) return;
+  int n = (int)sizes.size();
+  for ( int i = pos + 1; i <= n; i += (i & -i) ) sums[i] += delta;
+}
+
+// Return the sum of entries [0 .. pos-1] of the prefix sums
+long Fl_Table::SizeVector::prefix_sums(int pos) {
+  if ( pos <= 0 ) return(0);
+  if ( !sums ) build_sums();
+  long total = 0;
+  for ( int i = pos; i > 0; i -= (i & -i) ) total += sums[i];
+  return(total);
+}
+
+// Return the size of row/col 'x', which must exist
+int Fl_Table::SizeVector::operator[](int x) {
+  if ( !sparse ) return(sizes[x]);
+  int pos = lookup(x);
+  return( ( pos < (int)index.size() && index[pos] == x ) ? sizes[pos] : dflt );
+}
+
+// Change the number of rows/cols, new ones are set to 'fill'
+void Fl_Table::SizeVector::size(unsigned int newcount, int fill) {
+  int now_size = count;
+  if ( (int)newcount == now_size ) return;
+  count = (int)newcount;
+  if ( sparse ) {
+    index.size(lookup(count));			// drop rows/cols beyond the end
+    sizes.size(index.size());
+    free_sums();				// rebuilt on demand
+    if ( now_size == 0 ) {
+      dflt = fill;
+    } else if ( count > now_size && fill != dflt ) {
+      make_dense();
+      while ( now_size < count ) {
+        sizes[now_size++] = fill;		// fill new
+      }
+    }
+    return;
+  }
+  sizes.size(newcount);
+  while ( now_size < count ) {
+    sizes[now_size++] = fill;			// fill new
+  }
+  free_sums();					// rebuilt on demand
+}
+
+// Set the size of row/col 'x', which must already exist
+void Fl_Table::SizeVector::set(int x, int val) {
+  if ( !sparse ) {
+    int delta = val - sizes[x];
+    sizes[x] = val;
+    add_sums(x, delta);
+    return;
+  }
+  int pos = lookup(x);
+  if ( pos < (int)index.size() && index[pos] == x ) {
+    if ( val == dflt ) {			// back to default: forget it
+      remove(pos);
+    } else {
+      int delta = val - sizes[pos];
+      sizes[pos] = val;
+      add_sums(pos, delta);
+    }
+  } else if ( val != dflt ) {
+    // Too many customized rows/cols? Storing all sizes is cheaper
+    if ( ((int)index.size() + 1) * 4 > count ) {
+      make_dense();
+      set(x, val);
+    } else {
+      insert(pos, x, val);
+    }
+  }
+}
+
+// Set the size of all rows/cols to 'val'
+void Fl_Table::SizeVector::set_all(int val) {
+  index.size(0);
+  sizes.size(0);
+  free_sums();
+  sparse = 1;
+  dflt = val;
+}
+
+// Return the total size of rows/cols [0 .. x-1], ie. the scroll position of 'x'
+long Fl_Table::SizeVector::offset(int x) {
+  if ( x > count ) x = count;
+  if ( x <= 0 ) return(0);
+  if ( !sparse ) return(prefix_sums(x));
+  // OPTIMIZATION: closed form for the default sized rows/cols
+  long total = (long)x * dflt;
+  if ( index.size() > 0 ) total += prefix_sums(lookup(x));
+  return(total);
+}
+
+// Return the row/col whose extent contains scroll position 'pos',
+// ie. the largest x such that offset(x) <= pos.
+// Returns size() if 'pos' is beyond the last row/col.
+int Fl_Table::SizeVector::find(long pos) {
+  if ( pos < 0 || count == 0 ) return(0);
+  if ( sparse && index.size() == 0 ) {		// OPTIMIZATION: all the same size
+    if ( dflt <= 0 ) return(count);
+    long x = pos / dflt;
+    return( x > count ? count : (int)x );
+  }
+  if ( sparse ) {
+    // Binary search on the row/col number
+    int lo = 0, hi = count;
+    while ( lo < hi ) {
+      int mid = lo + (hi - lo + 1) / 2;
+      if ( offset(mid) <= pos ) lo = mid;
+      else hi = mid - 1;
+    }
+    return(lo);
+  }
+  // Dense: descend the Fenwick tree
+  if ( !sums ) build_sums();
+  int x = 0;
+  int step = 1;
+  while ( step * 2 <= count ) step *= 2;
+  for ( ; step > 0; step /= 2 ) {
+    if ( x + step <= count && sums[x + step] <= pos ) {
+      x += step;
+      pos -= sums[x];
+    }
+  }
+  return(x);
+}
+
+// Offscreen cache of the rendered data cells (private to Fl_Table)
+//
+//    'dirty' has one flag per cell in rows r0..r0+nr-1 and cols c0..c0+nc-1,
+//    which is the range of visible cells when the flags were last set.
+//    Cells outside that range are not in the cached image, so they are
+//    drawn anyway once they are scrolled into view.
+
+// Image surface whose origin can be moved to the top/left of the data area,
+//    so that draw_cell() gets the same window coordinates as on screen
+class Fl_Table_Cache_Surface : public Fl_Image_Surface {
+public:
+  Fl_Table_Cache_Surface(int W, int H) : Fl_Image_Surface(W, H, 1) { }
+  void translate(int X, int Y) { Fl_Image_Surface::translate(X, Y); }
+  void untranslate() { Fl_Image_Surface::untranslate(); }
+};
+
+struct Fl_Table::CellCache {
+  Fl_Table_Cache_Surface *off;	// rendered data cells, 0 if not created yet
+  int w, h;			// size of 'off' in FLTK units
+  float scale;			// scale factor 'off' was created with
+  int hpos, vpos;		// scroll position of the cached image
+  int r0, c0, nr, nc;		// range of cells covered by 'dirty'
+  char *dirty;			// one flag per cell in range
+  char all;			// 1: all cells need to be drawn
+  CellCache() {
+    off = 0; w = h = 0; scale = 0; hpos = vpos = 0;
+    r0 = c0 = nr = nc = 0; dirty = 0; all = 1;
+  }
+  ~CellCache() {
+    delete off;
+    if ( dirty ) free(dirty);
+  }
+  // Make 'dirty' cover the given range, keeping flags of cells in both ranges
+  void range(int R0, int C0, int NR, int NC) {
+    if ( R0 == r0 && C0 == c0 && NR == nr && NC == nc ) return;
+    char *d = (char*)malloc(NR * NC + 1);
+    for ( int r = 0; r < NR; r++ ) {
+      for ( int c = 0; c < NC; c++ ) {
+        d[r * NC + c] = is_dirty(R0 + r, C0 + c);
+      }
+    }
+    if ( dirty ) free(dirty);
+    dirty = d;
+    r0 = R0; c0 = C0; nr = NR; nc = NC;
+  }
+  // Cells outside the range are not in the cached image, so are always dirty
+  int is_dirty(int R, int C) {
+    if ( all ) return(1);
+    R -= r0; C -= c0;
+    return( R < 0 || R >= nr || C < 0 || C >= nc || dirty[R * nc + C] );
+  }
+};
 
 /** Sets the vertical scroll position so 'row' is at the top,
     and causes the screen to redraw.
@@ -63,7 +330,7 @@ void Fl_Table::row_position(int row) {
   }
   vscrollbar->Fl_Slider::value(newtop);
   table_scrolled();
-  redraw();
+  _redraw_scrolled();
   _row_position = row;	// HACK: override what table_scrolled() came up with
 }
 
@@ -82,7 +349,7 @@ void Fl_Table::col_position(int col) {
   }
   hscrollbar->Fl_Slider::value(newleft);
   table_scrolled();
-  redraw();
+  _redraw_scrolled();
   _col_position = col;	// HACK: override what table_scrolled() came up with
 }
 
@@ -90,38 +357,14 @@ void Fl_Table::col_position(int col) {
   Returns the scroll position (in pixels) of the specified 'row'.
 */
 long Fl_Table::row_scroll_position(int row) {
-  int startrow = 0;
-  long scroll = 0; 
-  // OPTIMIZATION: 
-  //     Attempt to use precomputed row scroll position
-  //
-  if ( toprow_scrollpos != -1 && row >= toprow ) {
-    scroll = toprow_scrollpos;
-    startrow = toprow;
-  }
-  for ( int t=startrow; t<row; t++ ) {
-    scroll += row_height(t);
-  }
-  return(scroll);
+  return(_rowheights.offset(row));
 }
 
 /**
   Returns the scroll position (in pixels) of the specified column 'col'.
 */
 long Fl_Table::col_scroll_position(int col) {
-  int startcol = 0;
-  long scroll = 0;
-  // OPTIMIZATION: 
-  //     Attempt to use precomputed row scroll position
-  //
-  if ( leftcol_scrollpos != -1 && col >= leftcol ) {
-    scroll = leftcol_scrollpos;
-    startcol = leftcol;
-  }
-  for ( int t=startcol; t<col; t++ ) {
-    scroll += col_width(t);
-  }
-  return(scroll);
+  return(_colwidths.offset(col));
 }
 
 /**
@@ -167,6 +410,7 @@ Fl_Table::Fl_Table(int X, int Y, int W, int H, const char *l) : Fl_Group(X,Y,W,H
   select_col        = -1;
   _scrollbar_size   = 0;
   flags_            = 0;	// TABCELLNAV off
+  _cell_cache       = 0;
   box(FL_THIN_DOWN_FRAME);
   
   vscrollbar = new Fl_Scrollbar(x()+w()-Fl::scrollbar_size(), y(),
@@ -200,6 +444,7 @@ Fl_Table::Fl_Table(int X, int Y, int W, int H, const char *l) : Fl_Group(X,Y,W,H
 */
 Fl_Table::~Fl_Table() {
   // The parent Fl_Group takes care of destroying scrollbars
+  delete _cell_cache;
 }
 
 /**
@@ -214,13 +459,10 @@ void Fl_Table::row_height(int row, int height) {
     return;		// OPTIMIZATION: no change? avoid redraw
   }
   // Add row heights, even if none yet
-  int now_size = (int)_rowheights.size();
-  if ( row >= now_size ) {
-    _rowheights.size(row);
-    while (now_size < row)
-      _rowheights[now_size++] = height;
+  if ( row >= (int)_rowheights.size() ) {
+    _rowheights.size(row+1, height);
   }
-  _rowheights[row] = height;
+  _rowheights.set(row, height);
   table_resized();
   if ( row <= botrow ) {	// OPTIMIZATION: only redraw if onscreen or above screen
     redraw();
@@ -243,14 +485,10 @@ void Fl_Table::col_width(int col, int width)
     return;			// OPTIMIZATION: no change? avoid redraw
   }
   // Add column widths, even if none yet
-  int now_size = (int)_colwidths.size();
-  if ( col >= now_size ) {
-    _colwidths.size(col+1);
-    while (now_size < col) {
-      _colwidths[now_size++] = width;
-    }
+  if ( col >= (int)_colwidths.size() ) {
+    _colwidths.size(col+1, width);
   }
-  _colwidths[col] = width;
+  _colwidths.set(col, width);
   table_resized();
   if ( col <= rightcol ) {	// OPTIMIZATION: only redraw if onscreen or to the left
     redraw();
@@ -261,6 +499,50 @@ void Fl_Table::col_width(int col, int width)
   }
 }
 
+/**
+  Convenience method to set the height of all rows to the
+  same value, in pixels. The screen is redrawn.
+
+  This is done in one step regardless of the number of rows, and
+  afterwards no memory is used per row until individual row heights
+  are changed again. callback() is invoked once with CONTEXT_RC_RESIZE
+  (and row 0) if when() is FL_WHEN_CHANGED.
+
+  \note FLTK 1.3 invoked the callback once for every row whose size
+  changed, with that row's number.
+*/
+void Fl_Table::row_height_all(int height) {
+  _rowheights.set_all(height);
+  table_resized();
+  redraw();
+  // ROW RESIZE CALLBACK
+  if ( Fl_Widget::callback() && when() & FL_WHEN_CHANGED ) {
+    do_callback(CONTEXT_RC_RESIZE, 0, 0);
+  }
+}
+
+/**
+  Convenience method to set the width of all columns to the
+  same value, in pixels. The screen is redrawn.
+
+  This is done in one step regardless of the number of columns, and
+  afterwards no memory is used per column until individual column widths
+  are changed again. callback() is invoked once with CONTEXT_RC_RESIZE
+  (and column 0) if when() is FL_WHEN_CHANGED.
+
+  \note FLTK 1.3 invoked the callback once for every column whose size
+  changed, with that column's number.
+*/
+void Fl_Table::col_width_all(int width) {
+  _colwidths.set_all(width);
+  table_resized();
+  redraw();
+  // COLUMN RESIZE CALLBACK
+  if ( Fl_Widget::callback() && when() & FL_WHEN_CHANGED ) {
+    do_callback(CONTEXT_RC_RESIZE, 0, 0);
+  }
+}
+
 /**
   Return specified row/col values R and C to within the table's
   current row/col limits.
@@ -563,37 +845,28 @@ void Fl_Table::recalc_dimensions() {
 */
 void Fl_Table::table_scrolled() {
   // Find top row
-  int y, row, voff = vscrollbar->value();
-  for ( row=y=0; row < _rows; row++ ) {
-    y += row_height(row);
-    if ( y > voff ) { y -= row_height(row); break; }
-  }
+  //    OPTIMIZATION: row/col lookups use the prefix sums in
+  //    _rowheights/_colwidths, so this is O(log n) even for huge tables.
+  //
+  int row, voff = vscrollbar->value();
+  row = _rowheights.find(voff);
   _row_position = toprow = ( row >= _rows ) ? (row - 1) : row;
-  toprow_scrollpos = y;		// OPTIMIZATION: save for later use 
+  toprow_scrollpos = row_scroll_position(toprow);	// OPTIMIZATION: save for later use
   // Find bottom row
   voff = vscrollbar->value() + tih;
-  for ( ; row < _rows; row++ ) {
-    y += row_height(row);
-    if ( y >= voff ) { break; }
-  }
-  botrow = ( row >= _rows ) ? (row - 1) : row; 
+  row = _rowheights.find(voff - 1);
+  if ( row < toprow ) row = toprow;
+  botrow = ( row >= _rows ) ? (_rows - 1) : row;
   // Left column
-  int x, col, hoff = hscrollbar->value();
-  for ( col=x=0; col < _cols; col++ ) {
-    x += col_width(col);
-    if ( x > hoff ) { x -= col_width(col); break; }
-  }
+  int col, hoff = hscrollbar->value();
+  col = _colwidths.find(hoff);
   _col_position = leftcol = ( col >= _cols ) ? (col - 1) : col;
-  leftcol_scrollpos = x;	// OPTIMIZATION: save for later use 
+  leftcol_scrollpos = col_scroll_position(leftcol);	// OPTIMIZATION: save for later use
   // Right column
-  //    Work with data left over from leftcol calculation
-  //
   hoff = hscrollbar->value() + tiw;
-  for ( ; col < _cols; col++ ) {
-    x += col_width(col);
-    if ( x >= hoff ) { break; }
-  }
-  rightcol = ( col >= _cols ) ? (col - 1) : col; 
+  col = _colwidths.find(hoff - 1);
+  if ( col < leftcol ) col = leftcol;
+  rightcol = ( col >= _cols ) ? (_cols - 1) : col;
   // First tell children to scroll
   draw_cell(CONTEXT_RC_RESIZE, 0,0,0,0,0,0);
 }
@@ -649,22 +922,22 @@ void Fl_Table::scroll_cb(Fl_Widget*w, void *data) {
   Fl_Table *o = (Fl_Table*)data;
   o->recalc_dimensions();	// recalc tix, tiy, etc.
   o->table_scrolled();
-  o->redraw();
+  o->_redraw_scrolled();
 }
 
 /**
   Sets the number of rows in the table, and the table is redrawn.
+
+  New rows get the height of the last row. Row heights only use memory
+  for rows whose height differs from the others, so even tables with
+  many millions of rows can be created quickly.
 */
 void Fl_Table::rows(int val) {
   int oldrows = _rows;
   _rows = val;
   {
     int default_h = ( _rowheights.size() > 0 ) ? _rowheights.back() : 25;
-    int now_size = _rowheights.size();
-    _rowheights.size(val);			// enlarge or shrink as needed
-    while ( now_size < val ) {
-      _rowheights[now_size++] = default_h;	// fill new
-    }
+    _rowheights.size(val, default_h);		// enlarge or shrink as needed
   }
   table_resized();
   
@@ -682,12 +955,8 @@ void Fl_Table::rows(int val) {
 void Fl_Table::cols(int val) {
   _cols = val;
   {
-    int default_w = ( _colwidths.size() > 0 ) ? _colwidths[_colwidths.size()-1] : 80;
-    int now_size = _colwidths.size();
-    _colwidths.size(val);			// enlarge or shrink as needed
-    while ( now_size < val ) {
-      _colwidths[now_size++] = default_w;	// fill new
-    }
+    int default_w = ( _colwidths.size() > 0 ) ? _colwidths.back() : 80;
+    _colwidths.size(val, default_w);		// enlarge or shrink as needed
   }
   table_resized();
   redraw();
@@ -989,7 +1258,7 @@ int Fl_Table::handle(int event) {
           // Dragging a cell selection?
 	  if ( _event_clicks ) break;			// STR #3018 - item 2
           if (select_row != R || select_col != C) {
-            damage_zone(current_row, current_col, select_row, select_col, R, C);
+            _damage_selection(select_row, select_col, R, C);
           }
           select_row = R;
           select_col = C;
@@ -1173,6 +1442,174 @@ void Fl_Table::_redraw_cell(TableContext context, int r, int c) {
   draw_cell(context, r, c, X, Y, W, H);	// call users' function to draw it
 }
 
+/**
+  Enables or disables caching of the rendered data cells.
+
+  When enabled, the data cells are drawn into an offscreen buffer which
+  is then copied to the screen. When the table is scrolled, the cached
+  image is shifted with fl_scroll() and draw_cell() is only called for
+  the cells scrolled into view. When only some cells are invalidated with
+  redraw_range() (e.g. when the selection changes), only those cells are
+  drawn. This can speed up scrolling and selecting in tables with many
+  or expensive cells considerably.
+
+  The cache only saves drawing when the table is scrolled or cells are
+  invalidated with redraw_range(). All visible cells are drawn again
+  whenever the table gets FL_DAMAGE_ALL, i.e. after redraw(), after the
+  table was resized or its rows or columns changed, and when its window
+  was exposed or its parent redrawn, because the table can't tell whether
+  cell contents changed then. Such full redraws are not faster than
+  without the cache.
+
+  draw_cell() receives the same window coordinates for data cells
+  (CONTEXT_CELL) as without the cache; the drawing goes to the offscreen
+  buffer and is clipped to the data area. Headers are not cached.
+
+  The cell cache should not be used for tables containing FLTK widgets.
+
+  \param[in] flag 1 to enable the cell cache, 0 to disable it (default)
+  \see cell_cache()
+*/
+void Fl_Table::cell_cache(int flag) {
+  if ( flag && !_cell_cache ) {
+    _cell_cache = new CellCache;
+  } else if ( !flag && _cell_cache ) {
+    delete _cell_cache;
+    _cell_cache = 0;
+  }
+  redraw();
+}
+
+// Redraw after a scroll.
+//    With the cell cache, draw() shifts the cached image and
+//    only draws the cells that were scrolled into view.
+//
+void Fl_Table::_redraw_scrolled() {
+  if ( _cell_cache ) damage(FL_DAMAGE_SCROLL);
+  else redraw();
+}
+
+// Mark cells in rows R1..R2, columns C1..C2 to be drawn into the cell cache
+void Fl_Table::_cell_cache_dirty(int R1, int R2, int C1, int C2) {
+  CellCache *cc = _cell_cache;
+  if ( cc->all || toprow < 0 || leftcol < 0 ) return;
+  cc->range(toprow, leftcol, botrow - toprow + 1, rightcol - leftcol + 1);
+  if ( R1 < toprow ) R1 = toprow;
+  if ( R2 > botrow ) R2 = botrow;
+  if ( C1 < leftcol ) C1 = leftcol;
+  if ( C2 > rightcol ) C2 = rightcol;
+  for ( int r = R1; r <= R2; r++ ) {
+    for ( int c = C1; c <= C2; c++ ) {
+      cc->dirty[(r - cc->r0) * cc->nc + (c - cc->c0)] = 1;
+    }
+  }
+}
+
+// fl_scroll() callback: mark cells in an area exposed by shifting the cell cache
+void Fl_Table::_cell_cache_exposed_cb(void *d, int X, int Y, int W, int H) {
+  Fl_Table *o = (Fl_Table*)d;
+  long hpos = (long)o->hscrollbar->value();
+  long vpos = (long)o->vscrollbar->value();
+  o->_cell_cache_dirty(o->_rowheights.find(vpos + Y), o->_rowheights.find(vpos + Y + H - 1),
+                       o->_colwidths.find(hpos + X), o->_colwidths.find(hpos + X + W - 1));
+}
+
+// The selection corner moved from R1/C1 to R2/C2: damage cells whose state changed.
+//    With the cell cache, only cells that were selected before or after (but
+//    not both) are invalidated, instead of the whole area around both ranges.
+//
+void Fl_Table::_damage_selection(int R1, int C1, int R2, int C2) {
+  if ( !_cell_cache || current_row < 0 || current_col < 0 || R1 < 0 || C1 < 0 ) {
+    damage_zone(current_row, current_col, R1, C1, R2, C2);
+    return;
+  }
+  int ot = current_row < R1 ? current_row : R1, ob = current_row < R1 ? R1 : current_row;
+  int ol = current_col < C1 ? current_col : C1, orr = current_col < C1 ? C1 : current_col;
+  int nt = current_row < R2 ? current_row : R2, nb = current_row < R2 ? R2 : current_row;
+  int nl = current_col < C2 ? current_col : C2, nr = current_col < C2 ? C2 : current_col;
+  int top = ( ot < nt ) ? ot : nt;
+  int bot = ( ob > nb ) ? ob : nb;
+  if ( top < toprow ) top = toprow;
+  if ( bot > botrow ) bot = botrow;
+  for ( int r = top; r <= bot; r++ ) {
+    int in_old = ( r >= ot && r <= ob );
+    int in_new = ( r >= nt && r <= nb );
+    if ( in_old && in_new ) {
+      // Both ranges contain current_col: only their ends differ
+      if ( ol != nl ) redraw_range(r, r, ol < nl ? ol : nl, ( ol < nl ? nl : ol ) - 1);
+      if ( orr != nr ) redraw_range(r, r, ( orr < nr ? orr : nr ) + 1, orr < nr ? nr : orr);
+    } else if ( in_old ) {
+      redraw_range(r, r, ol, orr);
+    } else if ( in_new ) {
+      redraw_range(r, r, nl, nr);
+    }
+  }
+}
+
+// Draw invalid cells into the cell cache, and copy it to the screen
+void Fl_Table::_draw_cell_cache() {
+  CellCache *cc = _cell_cache;
+  if ( tiw <= 0 || tih <= 0 ) return;
+  float s = Fl_Surface_Device::surface()->driver()->scale();
+  if ( damage() & FL_DAMAGE_ALL ) cc->all = 1;	// e.g. redraw(): cell contents may have changed
+  if ( !cc->off || cc->w != tiw || cc->h != tih || cc->scale != s ) {
+    delete cc->off;
+    cc->off = new Fl_Table_Cache_Surface(tiw, tih);
+    cc->w = tiw;
+    cc->h = tih;
+    cc->scale = s;
+    cc->all = 1;
+  }
+  int hpos = (int)hscrollbar->value();
+  int vpos = (int)vscrollbar->value();
+  // Drawing state set up by CONTEXT_STARTPAGE, for use in the offscreen
+  Fl_Font font = fl_font();
+  Fl_Fontsize size = fl_size();
+  Fl_Color fg = fl_color();
+  Fl_Surface_Device::push_current(cc->off);
+  if ( !cc->all && ( hpos != cc->hpos || vpos != cc->vpos ) ) {
+    if ( s != int(s) ) {
+      cc->all = 1;			// can't shift by whole pixels
+    } else {
+      // Shift cached image, mark cells in newly exposed areas
+      fl_scroll(0, 0, tiw, tih, cc->hpos - hpos, cc->vpos - vpos, _cell_cache_exposed_cb, this);
+    }
+  }
+  cc->hpos = hpos;
+  cc->vpos = vpos;
+  cc->off->translate(-tix, -tiy);	// draw_cell() uses window coordinates
+  fl_font(font, size);
+  fl_color(fg);
+  fl_push_clip(tix, tiy, tiw, tih);
+  {
+    int X, Y, W, H;
+    for ( int r = toprow; r <= botrow; r++ ) {
+      for ( int c = leftcol; c <= rightcol; c++ ) {
+        if ( r < 0 || c < 0 || !cc->is_dirty(r, c) ) continue;
+        find_cell(CONTEXT_CELL, r, c, X, Y, W, H);
+        draw_cell(CONTEXT_CELL, r, c, X, Y, W, H);
+      }
+    }
+    // Fill areas right of last column and below last row
+    if ( table_w - hpos < tiw ) {
+      fl_rectf(tix + table_w - hpos, tiy, tiw - (table_w - hpos), tih, color());
+    }
+    if ( table_h - vpos < tih ) {
+      fl_rectf(tix, tiy + table_h - vpos, tiw, tih - (table_h - vpos), color());
+    }
+  }
+  fl_pop_clip();
+  cc->off->untranslate();
+  Fl_Surface_Device::pop_current();
+  // All visible cells are valid now
+  cc->all = 0;
+  if ( toprow >= 0 && leftcol >= 0 ) {
+    cc->range(toprow, leftcol, botrow - toprow + 1, rightcol - leftcol + 1);
+    memset(cc->dirty, 0, cc->nr * cc->nc);
+  }
+  fl_copy_offscreen(tix, tiy, tiw, tih, cc->off->offscreen(), 0, 0);
+}
+
 /**
   See if the cell at row \p r and column \p c is selected.
   \returns 1 if the cell is selected, 0 if not.
@@ -1290,8 +1727,11 @@ void Fl_Table::draw() {
   // Clip all further drawing to the inner widget dimensions
   fl_push_clip(wix, wiy, wiw, wih);
   {
-    // Only redraw a few cells?
-    if ( ! ( damage() & FL_DAMAGE_ALL ) && _redraw_leftcol != -1 ) {
+    if ( _cell_cache ) {
+      // Cell cache? Draws invalid cells only, copies the rest
+      _draw_cell_cache();
+    } else if ( ! ( damage() & FL_DAMAGE_ALL ) && _redraw_leftcol != -1 ) {
+      // Only redraw a few cells
       fl_push_clip(tix, tiy, tiw, tih);
       for ( int c = _redraw_leftcol; c <= _redraw_rightcol; c++ ) {
         for ( int r = _redraw_toprow; r <= _redraw_botrow; r++ ) { 
@@ -1300,7 +1740,7 @@ void Fl_Table::draw() {
       }
       fl_pop_clip();
     }
-    if ( damage() & FL_DAMAGE_ALL ) {
+    if ( damage() & (FL_DAMAGE_ALL|FL_DAMAGE_SCROLL) ) {
       int X,Y,W,H;
       // Draw row headers, if any
       if ( row_header() ) {
@@ -1326,14 +1766,16 @@ void Fl_Table::draw() {
       //    to draw over dead zones, but on redraws it flickers. Avoid
       //    drawing over deadzones; prevent deadzones by sizing columns.
       //
-      fl_push_clip(tix, tiy, tiw, tih); {
-        for ( int r = toprow; r <= botrow; r++ ) {
-          for ( int c = leftcol; c <= rightcol; c++ ) {
-            _redraw_cell(CONTEXT_CELL, r, c); 
+      if ( !_cell_cache ) {
+        fl_push_clip(tix, tiy, tiw, tih); {
+          for ( int r = toprow; r <= botrow; r++ ) {
+            for ( int c = leftcol; c <= rightcol; c++ ) {
+              _redraw_cell(CONTEXT_CELL, r, c); 
+            }
           }
         }
+        fl_pop_clip(); 
       }
-      fl_pop_clip(); 
       // Draw little rectangle in corner of headers
       if ( row_header() && col_header() ) {
         fl_rectf(wix, wiy, row_header_width(), col_header_height(), color());
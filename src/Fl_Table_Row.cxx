@@ -28,6 +28,9 @@
 #include <FL/Fl.H>
 #include <FL/fl_draw.H>
 
+#include <stdlib.h>		// realloc/free
+#include <string.h>		// memcpy/memmove
+
 // for debugging...
 // #define DEBUG 1
 #ifdef DEBUG
@@ -39,30 +42,114 @@
 #define PRINTEVENT
 #endif
 
-// An STL-ish vector without templates (private to Fl_Table_Row)
+// A set of row ranges without templates (private to Fl_Table_Row)
+//
+//    arr[2*i] and arr[2*i+1] are the first and last row of range i.
+//    Ranges are sorted, don't overlap and are never adjacent (they would
+//    be merged), so a row is selected if it is inside one of them.
 
-void Fl_Table_Row::CharVector::copy(char *newarr, int newsize) {
-  size(newsize);
-  memcpy(arr, newarr, newsize * sizeof(char));
+Fl_Table_Row::RangeVector::~RangeVector() {	// DTOR
+  if (arr) free(arr);
+  arr = 0;
+}
+
+// Return the index of the first range that ends at or after 'row'
+//    (size() if none), using a binary search.
+int Fl_Table_Row::RangeVector::find(int row) const {
+  int lo = 0, hi = _size;
+  while ( lo < hi ) {
+    int mid = (lo + hi) / 2;
+    if ( last(mid) < row ) lo = mid + 1;
+    else hi = mid;
+  }
+  return(lo);
 }
 
-Fl_Table_Row::CharVector::~CharVector() {	// DTOR
+// Is 'row' in one of the ranges?
+int Fl_Table_Row::RangeVector::contains(int row) const {
+  int x = find(row);
+  return( x < _size && first(x) <= row ) ? 1 : 0;
+}
+
+// Remove all ranges
+void Fl_Table_Row::RangeVector::clear() {
   if (arr) free(arr);
   arr = 0;
+  _size = 0;
+}
+
+// Append range from..to to 'ranges', merging it with the previous range
+static void add_range(int *ranges, int &count, int from, int to) {
+  if ( from > to ) return;
+  if ( count > 0 && ranges[2*count-1] + 1 >= from ) {
+    if ( to > ranges[2*count-1] ) ranges[2*count-1] = to;
+    return;
+  }
+  ranges[2*count] = from;
+  ranges[2*count+1] = to;
+  count++;
 }
 
-void Fl_Table_Row::CharVector::size(int count) {
-  if (count != _size) {
-    arr = (char*)realloc(arr, count * sizeof(char));
-    _size = count;
+// Change rows from..to: flag 0=remove, 1=add, 2=toggle.
+//    Only the ranges touching from-1..to+1 are rebuilt, the ones
+//    after them are moved if their number changed.
+//    Returns 1 if anything changed, 0 if not.
+//
+int Fl_Table_Row::RangeVector::set(int from, int to, int flag) {
+  if ( from > to ) return(0);
+  // Ranges lo..hi-1 overlap or touch from..to
+  int lo = find(from > 0 ? from - 1 : from);
+  int hi = lo;
+  while ( hi < _size && ( to == 0x7fffffff || first(hi) <= to + 1 ) ) hi++;
+  // Build the new ranges that replace them
+  int *ranges = (int*)malloc((hi - lo + 3) * 2 * sizeof(int));
+  int count = 0;
+  for ( int x = lo; x < hi; x++ ) {		// unchanged parts before 'from'
+    add_range(ranges, count, first(x), last(x) < from - 1 ? last(x) : from - 1);
   }
+  switch ( flag ) {
+    case 0:					// remove: leave a gap
+      break;
+    case 2: {					// toggle: fill gaps only
+      int row = from;
+      for ( int x = lo; x < hi && row <= to; x++ ) {
+        if ( last(x) < row ) continue;
+        if ( first(x) > row ) add_range(ranges, count, row, first(x) - 1 < to ? first(x) - 1 : to);
+        if ( last(x) >= to ) { row = to + 1; break; }
+        row = last(x) + 1;
+      }
+      if ( row <= to ) add_range(ranges, count, row, to);
+      break;
+    }
+    default:					// add
+      add_range(ranges, count, from, to);
+      break;
+  }
+  for ( int x = lo; x < hi; x++ ) {		// unchanged parts after 'to'
+    if ( last(x) > to ) add_range(ranges, count, first(x) > to + 1 ? first(x) : to + 1, last(x));
+  }
+  // Any change?
+  int changed = ( count != hi - lo );
+  for ( int x = 0; !changed && x < count; x++ ) {
+    changed = ( ranges[2*x] != first(lo + x) || ranges[2*x+1] != last(lo + x) );
+  }
+  if ( changed ) {
+    int newsize = _size - (hi - lo) + count;
+    if ( newsize > _size ) arr = (int*)realloc(arr, newsize * 2 * sizeof(int));
+    memmove(arr + 2 * (lo + count), arr + 2 * hi, (_size - hi) * 2 * sizeof(int));
+    memcpy(arr + 2 * lo, ranges, count * 2 * sizeof(int));
+    _size = newsize;
+    if ( _size == 0 ) clear();
+  }
+  free(ranges);
+  return(changed);
 }
 
 
 // Is row selected?
 int Fl_Table_Row::row_selected(int row) {
   if ( row < 0 || row >= rows() ) return(-1);
-  return(_rowselect[row]);
+  return(_rowselect.contains(row));
 }
 
 // Change row selection type
@@ -70,20 +157,15 @@ void Fl_Table_Row::type(TableRowSelectMode val) {
   _selectmode = val;
   switch ( _selectmode ) {
     case SELECT_NONE: {
-      for ( int row=0; row<rows(); row++ ) {
-        _rowselect[row] = 0;
-      }
+      _rowselect.clear();
       redraw();
       break;
     }
     case SELECT_SINGLE: {
-      int count = 0;
-      for ( int row=0; row<rows(); row++ ) {
-        if ( _rowselect[row] ) {
-          if ( ++count > 1 ) {	// only one allowed
-            _rowselect[row] = 0;
-          }
-        }
+      if ( _rowselect.size() > 0 ) {	// only one allowed: keep the first
+        int row = _rowselect.first(0);
+        _rowselect.clear();
+        _rowselect.set(row, row, 1);
       }
       redraw();
       break;
@@ -113,30 +195,26 @@ int Fl_Table_Row::select_row(int row, int flag) {
       return(-1);
       
     case SELECT_SINGLE: {
-      int oldval;
-      for ( int t=0; t<rows(); t++ ) {
-        if ( t == row ) {
-          oldval = _rowselect[row];
-          if ( flag == 2 ) { _rowselect[row] ^= 1; }
-          else             { _rowselect[row] = flag; }
-          if ( oldval != _rowselect[row] ) {
-            redraw_range(row, row, leftcol, rightcol);
-            ret = 1;
-          }
-        }
-        else if ( _rowselect[t] ) {
-          _rowselect[t] = 0;
-          redraw_range(t, t, leftcol, rightcol);
-        }
+      int oldval = _rowselect.contains(row);
+      int newval = ( flag == 2 ) ? !oldval : ( flag ? 1 : 0 );
+      // Deselect all other rows
+      for ( int x = 0; x < _rowselect.size(); x++ ) {
+        int r1 = _rowselect.first(x), r2 = _rowselect.last(x);
+        if ( r1 < toprow ) r1 = toprow;
+        if ( r2 > botrow ) r2 = botrow;
+        if ( r1 <= r2 ) redraw_range(r1, r2, leftcol, rightcol);
+      }
+      _rowselect.clear();
+      if ( newval ) _rowselect.set(row, row, 1);
+      if ( oldval != newval ) {
+        redraw_range(row, row, leftcol, rightcol);
+        ret = 1;
       }
       break;
     }
       
     case SELECT_MULTI: {
-      int oldval = _rowselect[row];
-      if ( flag == 2 ) { _rowselect[row] ^= 1; }
-      else             { _rowselect[row] = flag; }
-      if ( _rowselect[row] != oldval ) {		// select state changed?
+      if ( _rowselect.set(row, row, flag) ) {		// select state changed?
         if ( row >= toprow && row <= botrow ) {		// row visible?
           // Extend partial redraw range
           redraw_range(row, row, leftcol, rightcol);
@@ -148,6 +226,63 @@ int Fl_Table_Row::select_row(int row, int flag) {
   return(ret);
 }
 
+/**
+ Changes the selection state of rows \p from to \p to (inclusive)
+ in one step, depending on the value of \p flag.
+ 0=deselected, 1=select, 2=toggle existing state.
+
+ This is much faster than calling select_row() for each row: the
+ cost depends on the number of selected ranges, not on the number
+ of rows. Only the visible part of the range is redrawn.
+
+ In SELECT_SINGLE mode only a single row can be selected or toggled.
+
+ \returns 1 if the selection changed, 0 if not, -1 if the range is
+ out of range or the selection mode doesn't allow the change.
+ */
+int Fl_Table_Row::select_rows(int from, int to, int flag) {
+  if ( from > to ) { int t = from; from = to; to = t; }
+  if ( from < 0 || to >= rows() ) { return(-1); }
+  switch ( _selectmode ) {
+    case SELECT_NONE:
+      return(-1);
+      
+    case SELECT_SINGLE:
+      if ( from == to ) return(select_row(from, flag));
+      if ( flag != 0 ) return(-1);
+      //FALLTHROUGH
+      
+    case SELECT_MULTI: {
+      if ( !_rowselect.set(from, to, flag) ) return(0);
+      if ( from < toprow ) from = toprow;		// redraw visible rows only
+      if ( to > botrow ) to = botrow;
+      if ( from <= to ) redraw_range(from, to, leftcol, rightcol);
+      return(1);
+    }
+  }
+  return(0);
+}
+
+/**
+ Returns the first and last row of the range of selected rows \p index.
+ Ranges are sorted by row, and \p index must be less than
+ selected_row_ranges(). For instance:
+ \code
+   for ( int i = 0; i < table->selected_row_ranges(); i++ ) {
+     int first, last;
+     table->selected_row_range(i, first, last);
+     printf("rows %d to %d are selected\n", first, last);
+   }
+ \endcode
+ \returns 0 on success, -1 if \p index is out of range.
+ */
+int Fl_Table_Row::selected_row_range(int index, int &first, int &last) const {
+  if ( index < 0 || index >= _rowselect.size() ) return(-1);
+  first = _rowselect.first(index);
+  last  = _rowselect.last(index);
+  return(0);
+}
+
 // Select all rows to a known state
 void Fl_Table_Row::select_all_rows(int flag) {
   switch ( _selectmode ) {
@@ -159,19 +294,7 @@ void Fl_Table_Row::select_all_rows(int flag) {
       //FALLTHROUGH
       
     case SELECT_MULTI: {
-      char changed = 0;
-      if ( flag == 2 ) {
-        for ( int row=0; row<(int)_rowselect.size(); row++ ) {
-          _rowselect[row] ^= 1;
-        }
-        changed = 1;
-      } else {
-        for ( int row=0; row<(int)_rowselect.size(); row++ ) {
-          changed |= (_rowselect[row] != flag)?1:0;
-          _rowselect[row] = flag; 
-        }
-      }
-      if ( changed ) {
+      if ( rows() > 0 && _rowselect.set(0, rows() - 1, flag) ) {
         redraw();
       }
     }
@@ -181,8 +304,7 @@ void Fl_Table_Row::select_all_rows(int flag) {
 // Set number of rows
 void Fl_Table_Row::rows(int val) {
   Fl_Table::rows(val);
-  while ( val > (int)_rowselect.size() ) { _rowselect.push_back(0); }	// enlarge
-  while ( val < (int)_rowselect.size() ) { _rowselect.pop_back(); }	// shrink
+  _rowselect.set(val < 0 ? 0 : val, 0x7fffffff, 0);	// deselect removed rows
 }
 
 // Handle events
@@ -234,14 +356,7 @@ int Fl_Table_Row::handle(int event) {
             case FL_SHIFT: {
               select_row(R, 1);
               if ( _last_row > -1 ) {
-                int srow = R, erow = _last_row;
-                if ( srow > erow ) {
-                  srow = _last_row;
-                  erow = R;
-                }
-                for ( int row = srow; row <= erow; row++ ) {
-                  select_row(row, 1);
-                }
+                select_rows(R, _last_row, 1);
               }
               break;
             }
@@ -300,14 +415,7 @@ int Fl_Table_Row::handle(int event) {
             default:
               select_row(R, 1);
               if ( _last_row > -1 ) {
-                int srow = R, erow = _last_row;
-                if ( srow > erow ) {
-                  srow = _last_row;
-                  erow = R;
-                }
-                for ( int row = srow; row <= erow; row++ ) {
-                  select_row(row, 1);
-                }
+                select_rows(R, _last_row, 1);
               }
               break;
           }
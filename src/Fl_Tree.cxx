@@ -77,7 +77,8 @@ static int find_total_children(Fl_Tree_Item *item, int count=0) {
 
 /// Constructor.
 Fl_Tree::Fl_Tree(int X, int Y, int W, int H, const char *L) : Fl_Group(X,Y,W,H,L) { 
-  _root = new Fl_Tree_Item(this);
+  _store = 0;					// made by the first item
+  _root = new(this) Fl_Tree_Item(this);
   _root->parent(0);				// we are root of tree
   _root->label("ROOT");
   _item_focus      = 0;
@@ -86,6 +87,9 @@ Fl_Tree::Fl_Tree(int X, int Y, int W, int H, const char *L) : Fl_Group(X,Y,W,H,L
   _scrollbar_size  = 0;				// 0: uses Fl::scrollbar_size()
 	
   _lastselect       = 0;
+  _populate_cb      = 0;
+  _populate_data    = 0;
+  _unload_closed    = 0;
 
   box(FL_DOWN_BOX);
   color(FL_BACKGROUND2_COLOR, FL_SELECTION_COLOR);
@@ -107,12 +111,15 @@ Fl_Tree::Fl_Tree(int X, int Y, int W, int H, const char *L) : Fl_Group(X,Y,W,H,L
   _toh = _tih = H - Fl::box_dh(box());
   _tree_w = -1;
   _tree_h = -1;
+  _subtree_gen = 1;
   end();
 }
 
 /// Destructor.
 Fl_Tree::~Fl_Tree() {
   if ( _root ) { delete _root; _root = 0; }
+  Fl_Tree_Item::release_store(_store);		// freed with the last item using it
+  _store = 0;
 }
 
 /// Extend the selection between and including \p 'from' and \p 'to'
@@ -330,8 +337,8 @@ int Fl_Tree::handle(int e) {
 	      set_item_focus(next_visible_item(_item_focus, ekey));	// next item up|dn
 	      if ( _item_focus ) {					// item in focus?
 	        // Autoscroll
-		int itemtop = _item_focus->y();
-		int itembot = _item_focus->y()+_item_focus->h();
+		int itemtop = item_y(_item_focus);
+		int itembot = itemtop + _item_focus->calc_item_height(_prefs);
 		if ( itemtop < y() ) { show_item_top(_item_focus); }
 		if ( itembot > y()+h() ) { show_item_bottom(_item_focus); }
 		// Extend selection
@@ -646,9 +653,12 @@ void Fl_Tree::calc_dimensions() {
 /// The tree hierarchy's size only changes when items are added/removed,
 /// open/closed, label contents or font sizes changed, margins changed, etc.
 ///
-/// This calculation involves walking the *entire* tree from top to bottom,
+/// This calculation involves walking the tree from top to bottom,
 /// potentially a slow calculation if the tree has many items (potentially
 /// hundreds of thousands), and should therefore be called sparingly.
+/// Each item caches the size of its subtree, so subtrees that didn't change
+/// since the last calculation are skipped, unless the cache was discarded
+/// with recalc_tree().
 ///
 /// For this reason, recalc_tree() is used as a way to /schedule/
 /// calculation when changes affect the tree hierarchy's size.
@@ -823,7 +833,7 @@ void Fl_Tree::root(Fl_Tree_Item *newitem) {
 Fl_Tree_Item* Fl_Tree::add(const char *path, Fl_Tree_Item *item) {
   // Tree has no root? make one
   if ( ! _root ) {
-    _root = new Fl_Tree_Item(this);
+    _root = new(this) Fl_Tree_Item(this);
     _root->parent(0);
     _root->label("ROOT");
   } 
@@ -1442,14 +1452,22 @@ int Fl_Tree::get_selected_items(Fl_Tree_Item_Array &ret_items) {
 ///     -   0 - callback() is not invoked
 ///     -   1 - callback() is invoked if item changed (default),
 ///             callback_reason() will be FL_TREE_REASON_OPENED
+/// If the item's children are loaded on demand (see Fl_Tree_Item::lazy_children())
+/// and were not loaded yet, populate() is called first to load them.
+///
 /// \returns
 ///     -   1 -- item was opened
-///     -   0 -- item was already open, no change
+///     -   0 -- item was already open, no change, or its children are being
+///              loaded asynchronously: it will be opened by populated().
 ///
 /// \see open(), close(), is_open(), is_close(), callback_item(), callback_reason()
 ///
 int Fl_Tree::open(Fl_Tree_Item *item, int docallback) {
   if ( item->is_open() ) return(0);
+  if ( populate(item) ) {		// lazy children still loading? open when done
+    item->_flags |= Fl_Tree_Item::OPEN_PENDING;
+    return(0);
+  }
   item->open();		// handles recalc_tree()
   redraw();
   if ( docallback ) {
@@ -1527,14 +1545,22 @@ void Fl_Tree::open_toggle(Fl_Tree_Item *item, int docallback) {
 ///     -   0 - callback() is not invoked
 ///     -   1 - callback() is invoked if item changed (default),
 ///             callback_reason() will be FL_TREE_REASON_CLOSED
+/// If unload_closed() is set and the item's children are loaded on demand,
+/// its children are deleted, and will be loaded again when it is reopened.
+///
 /// \returns
 ///     -   1 -- item was closed
 ///     -   0 -- item was already closed, no change
 /// \see open(), close(), is_open(), is_close(), callback_item(), callback_reason()
 ///
 int Fl_Tree::close(Fl_Tree_Item *item, int docallback) {
-  if ( item->is_close() ) return(0);
+  if ( item->is_close() ) {
+    item->_flags &= ~Fl_Tree_Item::OPEN_PENDING;	// don't open when loaded
+    return(0);
+  }
   item->close();		// handles recalc_tree()
+  if ( _unload_closed && item->lazy_children() && item->is_populated() )
+    unload_children(item);
   redraw();
   if ( docallback ) {
     do_callback_for_item(item, FL_TREE_REASON_CLOSED);
@@ -1571,6 +1597,260 @@ int Fl_Tree::close(const char *path, int docallback) {
   return(close(item, docallback));		// handles recalc_tree()
 }
 
+// Internal: Delete the children of a closed lazy item (see unload_closed()).
+void Fl_Tree::unload_children(Fl_Tree_Item *item) {
+  // Forget about the children first, if we track any of them.
+  for ( Fl_Tree_Item *p = _lastselect; p; p = p->parent() )
+    if ( p == item ) { _lastselect = 0; break; }
+  item->clear_children();		// (item focus is cleared by item dtors)
+  item->_flags &= ~Fl_Tree_Item::POPULATED;
+}
+
+// Internal: Open \p 'item' and its descendants down to \p 'depth' levels,
+//    without callbacks or redraws. Returns the number of items opened.
+//
+int Fl_Tree::open_subtree(Fl_Tree_Item *item, int depth) {
+  int count = 0;
+  if ( !item->is_open() ) {
+    if ( populate(item) ) {		// lazy children still loading? open when done
+      item->_flags |= Fl_Tree_Item::OPEN_PENDING;
+      return(0);
+    }
+    item->_flags |= Fl_Tree_Item::OPEN;	// not set_flag(): caller does one recalc_tree()
+    ++count;
+  }
+  if ( depth != 0 )
+    for ( int t=0; t<item->children(); t++ )
+      count += open_subtree(item->child(t), depth-1);
+  if ( count ) item->_subtree_gen = 0;	// cached geometry is stale
+  return(count);
+}
+
+// Internal: Close \p 'item' and all its descendants,
+//    without callbacks or redraws. Returns the number of items closed.
+//
+int Fl_Tree::close_subtree(Fl_Tree_Item *item) {
+  int count = 0;
+  if ( item->is_open() ) {
+    item->_flags &= ~Fl_Tree_Item::OPEN;	// not set_flag(): caller does one recalc_tree()
+    if ( _unload_closed && item->lazy_children() && item->is_populated() )
+      unload_children(item);
+    ++count;
+  } else {
+    item->_flags &= ~Fl_Tree_Item::OPEN_PENDING;	// don't open when loaded
+  }
+  for ( int t=0; t<item->children(); t++ )
+    count += close_subtree(item->child(t));
+  if ( count ) item->_subtree_gen = 0;	// cached geometry is stale
+  return(count);
+}
+
+/// Opens \p 'item' and its descendants down to \p 'depth' levels below it.
+///
+/// Unlike calling open() for each item, this changes all the items in one
+/// pass over the subtree, recalculates the tree's size only once, and
+/// invokes the callback only once, making e.g. an "expand all" of a large
+/// tree fast.
+///
+/// Items whose children are loaded on demand (see Fl_Tree_Item::lazy_children())
+/// are loaded with populate() first. If their children are being loaded
+/// asynchronously, they are opened when loading completes, but their
+/// children aren't. Note that opening all levels (\p 'depth' -1) of a
+/// hierarchy loaded on demand loads all of it.
+///
+/// \param[in] item The topmost item to be opened. If NULL, root() is used.
+/// \param[in] depth How many levels below \p 'item' to open:
+///     0 opens just \p 'item', 1 also its children, etc. -1 opens all levels (default).
+/// \param[in] docallback -- A flag that determines if the callback() is invoked or not:
+///     -   0 - callback() is not invoked
+///     -   1 - callback() is invoked once if any items were opened (default),
+///             callback_reason() will be FL_TREE_REASON_OPEN_CHANGED,
+///             callback_item() will be \p 'item'
+/// \returns The number of items that were opened.
+/// \see close_all(), open()
+/// \version 1.4.0
+///
+int Fl_Tree::open_all(Fl_Tree_Item *item, int depth, int docallback) {
+  item = item ? item : _root;			// NULL? use root()
+  if ( ! item ) return(0);
+  int count = open_subtree(item, depth);
+  if ( !count ) return(0);
+  if ( item->is_open() ) {			// show widgets of newly shown items
+    for ( int t=0; t<item->children(); t++ )
+      item->child(t)->show_widgets();
+  }
+  item->recalc_tree();				// also invalidates parents' geometry
+  redraw();
+  if ( docallback ) {
+    do_callback_for_item(item, FL_TREE_REASON_OPEN_CHANGED);
+  }
+  return(count);
+}
+
+/// Closes \p 'item' and all its descendants.
+///
+/// Like open_all(), this changes all the items in one pass and invokes
+/// the callback only once. If unload_closed() is set, the children of the
+/// lazy items that are closed are deleted.
+///
+/// If \p 'item' is the root and showroot() is off, the root is left open
+/// and only its descendants are closed, since a hidden root could not be
+/// opened again by the user.
+///
+/// \param[in] item The topmost item to be closed. If NULL, root() is used.
+/// \param[in] docallback -- A flag that determines if the callback() is invoked or not:
+///     -   0 - callback() is not invoked
+///     -   1 - callback() is invoked once if any items were closed (default),
+///             callback_reason() will be FL_TREE_REASON_OPEN_CHANGED,
+///             callback_item() will be \p 'item'
+/// \returns The number of items that were closed.
+/// \see open_all(), close()
+/// \version 1.4.0
+///
+int Fl_Tree::close_all(Fl_Tree_Item *item, int docallback) {
+  item = item ? item : _root;			// NULL? use root()
+  if ( ! item ) return(0);
+  int count = 0, t;
+  if ( item == _root && !showroot() ) {		// hidden root? keep it open
+    for ( t=0; t<item->children(); t++ )
+      count += close_subtree(item->child(t));
+  } else {
+    count = close_subtree(item);
+  }
+  if ( !count ) return(0);
+  for ( t=0; t<item->children(); t++ ) {	// hide widgets of hidden items
+    Fl_Tree_Item *c = item->child(t);
+    if ( !item->is_open() ) { c->hide_widgets(); continue; }
+    for ( int u=0; u<c->children(); u++ ) c->child(u)->hide_widgets();
+  }
+  item->recalc_tree();				// also invalidates parents' geometry
+  redraw();
+  if ( docallback ) {
+    do_callback_for_item(item, FL_TREE_REASON_OPEN_CHANGED);
+  }
+  return(count);
+}
+
+/// Set the callback that loads the children of items marked with
+/// Fl_Tree_Item::lazy_children().
+///
+/// This lets an application show a huge hierarchy without creating all
+/// of its items up front: it adds items with lazy children, and adds
+/// their children only when the user opens them. The callback is invoked
+/// by populate(), which open() calls for such an item before opening it.
+///
+/// The callback is passed the tree, the item and \p 'data'. It should
+/// either:
+///   - add the item's children (e.g. with add() or Fl_Tree_Item::add()),
+///     possibly none, and return 0. The item is then opened, or
+///   - start loading the children asynchronously and return 1. The item
+///     stays closed, and is_populating() returns 1 until the application
+///     adds the children and calls populated(), which opens the item.
+///
+/// The asynchronous case is typically used to load children from a slow
+/// source in a worker thread, which then uses Fl::awake(Fl_Awake_Handler, void*)
+/// to have the main thread add the items and call populated(). Note that
+/// the items of the tree must only be changed by the main thread, and that
+/// an application that may remove items in the meantime should look up the
+/// item again (e.g. with find_item()) before calling populated():
+///
+/// \code
+/// int populate_cb(Fl_Tree *tree, Fl_Tree_Item *item, void *data) {
+///   char path[FL_PATH_MAX];
+///   tree->item_pathname(path, sizeof(path), item);
+///   start_worker_thread(strdup(path));	// eventually calls Fl::awake(loaded_cb, result)
+///   return 1;				// loading asynchronously
+/// }
+/// void loaded_cb(void *result) {		// runs in the main thread
+///   Fl_Tree_Item *item = tree->find_item(result_path(result));
+///   if ( !item ) return;			// item was removed meanwhile
+///   for ( .. ) tree->add(item, ..);	// add the children
+///   tree->populated(item);		// opens the item
+/// }
+/// [..]
+///   tree->populate_callback(populate_cb);
+///   item = tree->add("Inventory/Warehouse 12");
+///   item->lazy_children(1);
+/// \endcode
+///
+/// \param[in] cb The callback, or NULL to disable (lazy children are then
+///                considered loaded when their parent is opened)
+/// \param[in] data User data passed to the callback
+/// \see populate(), populated(), unload_closed(), Fl_Tree_Item::lazy_children()
+/// \version 1.4.0
+///
+void Fl_Tree::populate_callback(Fl_Tree_Populate_Callback *cb, void *data) {
+  _populate_cb   = cb;
+  _populate_data = data;
+}
+
+/// Load the children of \p 'item' if they are loaded on demand and
+/// haven't been loaded yet, by invoking the populate callback.
+///
+/// This is done automatically by open(), but can also be used to
+/// preload children, e.g. to prefetch them or before iterating them.
+/// \param[in] item The item whose children are loaded. Must not be NULL.
+/// \returns
+///     -   0 -- the children are loaded (or were already)
+///     -   1 -- the children are being loaded asynchronously
+/// \see populate_callback(), populated()
+/// \version 1.4.0
+///
+int Fl_Tree::populate(Fl_Tree_Item *item) {
+  if ( item->is_populating() ) return(1);
+  if ( item->is_populated() ) return(0);
+  item->_flags |= Fl_Tree_Item::POPULATING;
+  if ( _populate_cb && _populate_cb(this, item, _populate_data) )
+    return(1);				// loading asynchronously
+  item->_flags &= ~Fl_Tree_Item::POPULATING;
+  item->_flags |= Fl_Tree_Item::POPULATED;
+  item->recalc_tree();			// may change tree geometry
+  redraw();
+  return(0);
+}
+
+/// Tell the tree that the asynchronous loading of the children
+/// of \p 'item' started by the populate callback has completed.
+///
+/// Must be called from the main thread, after adding the children.
+/// If the loading was started by open(), the item is opened now.
+///
+/// \param[in] item The item whose children were loaded. Must not be NULL.
+/// \param[in] docallback -- A flag that determines if the callback() is invoked
+///                          if the item is opened (see open())
+/// \returns
+///     -   1 -- the item was opened
+///     -   0 -- the item was not opened
+///     -  -1 -- the item's children were not being loaded
+/// \see populate_callback(), populate()
+/// \version 1.4.0
+///
+int Fl_Tree::populated(Fl_Tree_Item *item, int docallback) {
+  if ( !item->is_populating() ) return(-1);
+  int doopen = (item->_flags & Fl_Tree_Item::OPEN_PENDING) ? 1 : 0;
+  item->_flags &= ~(Fl_Tree_Item::POPULATING|Fl_Tree_Item::OPEN_PENDING);
+  item->_flags |= Fl_Tree_Item::POPULATED;
+  item->recalc_tree();			// may change tree geometry
+  redraw();
+  return(doopen ? open(item, docallback) : 0);
+}
+
+/// Set whether the children of items marked with Fl_Tree_Item::lazy_children()
+/// are deleted when the item is closed with close(), to be loaded again
+/// by the populate callback when the item is reopened.
+///
+/// This bounds the memory used when browsing a huge hierarchy, at the cost
+/// of loading the children again, and of losing their state (e.g. selection,
+/// open/close state of the children).
+///
+/// \param[in] val 1: unload children of closed lazy items, 0: keep them (default)
+/// \see populate_callback()
+/// \version 1.4.0
+///
+void Fl_Tree::unload_closed(int val) {
+  _unload_closed = val ? 1 : 0;
+}
+
 /// See if \p 'item' is open.
 ///
 /// Items that are 'open' are themselves not necessarily visible;
@@ -1893,6 +2173,127 @@ int Fl_Tree::select_all(Fl_Tree_Item *item, int docallback) {
   return(count);
 }
 
+// Internal: Change the selection state of \p 'item' without callbacks
+//    or redraws. \p 'val' is 0=deselect, 1=select, 2=toggle.
+//    Returns 1 if the item's state changed.
+//
+int Fl_Tree::select_state(Fl_Tree_Item *item, int val) {
+  switch ( val ) {
+    case 0:
+      if ( !item->is_selected() ) return(0);
+      item->deselect();
+      return(1);
+    case 1:
+      if ( item->is_selected() ) return(0);
+      item->select();
+      return(1);
+    default:
+      item->select_toggle();
+      return(1);		// toggle always involves a change
+  }
+}
+
+/// Select, deselect or toggle all items between and including
+/// \p 'from' and \p 'to', in either order.
+///
+/// Unlike extend_selection(), which handles each item with select() etc.,
+/// this changes all the items in one pass, and invokes the callback only
+/// once, which makes selecting large ranges fast.
+///
+/// \param[in] from    Starting item
+/// \param[in] to      Ending item
+/// \param[in] val     0=deselect, 1=select (default), 2=toggle
+/// \param[in] visible true=affect only displayed items (\p 'from' and \p 'to'
+///                    must be displayed),<br>
+///                    false=affect open or closed items (default)
+/// \param[in] docallback -- A flag that determines if the callback() is invoked or not:
+///     -   0 - the callback() is not invoked
+///     -   1 - the callback() is invoked once if any items changed state (default),
+///             callback_reason() will be FL_TREE_REASON_SELECTION_CHANGED,
+///             callback_item() will be NULL
+/// \returns The number of items whose selection states were changed, if any.
+/// \see select_if(), extend_selection()
+/// \version 1.4.0
+///
+int Fl_Tree::select_range(Fl_Tree_Item *from, Fl_Tree_Item *to,
+                          int val, bool visible, int docallback) {
+  int changed = 0;
+  char on = 0;
+  for ( Fl_Tree_Item *item = visible ? first_visible_item() : first();
+        item;
+        item = visible ? item->next_visible(_prefs) : item->next() ) {
+    int edge = ( item == from || item == to ) ? 1 : 0;
+    if ( !on && !edge ) continue;
+    changed += select_state(item, val);
+    if ( edge ) {
+      on ^= 1;
+      if ( !on || from == to ) break;	// done
+    }
+  }
+  if ( changed ) {
+    set_changed();
+    redraw();
+    if ( docallback ) {
+      do_callback_for_item(0, FL_TREE_REASON_SELECTION_CHANGED);
+    }
+  }
+  return(changed);
+}
+
+// Internal: Apply select_if() to \p 'item' and its descendants.
+int Fl_Tree::select_subtree_if(Fl_Tree_Item *item, Fl_Tree_Item_Predicate *pred,
+                               void *data, int val) {
+  int changed = 0;
+  if ( pred(item, data) )
+    changed += select_state(item, val);
+  for ( int t=0; t<item->children(); t++ )
+    changed += select_subtree_if(item->child(t), pred, data, val);
+  return(changed);
+}
+
+/// Select, deselect or toggle all items for which \p 'pred' returns non-zero.
+///
+/// The predicate is called for \p 'item' and all its descendants, open or
+/// closed, in tree order. All changes are made in one pass, and the callback
+/// is invoked only once. Example:
+///
+/// \code
+/// static int is_header(Fl_Tree_Item *item, void *data) {
+///   const char *label = item->label();
+///   return(label && strstr(label, ".h") != 0);
+/// }
+/// [..]
+///   tree->select_if(is_header);		// select all the .h files
+/// \endcode
+///
+/// \param[in] pred The predicate
+/// \param[in] data User data passed to \p 'pred'
+/// \param[in] val 0=deselect, 1=select (default), 2=toggle
+/// \param[in] item The topmost item to be considered. If NULL, root() is used.
+/// \param[in] docallback -- A flag that determines if the callback() is invoked or not:
+///     -   0 - the callback() is not invoked
+///     -   1 - the callback() is invoked once if any items changed state (default),
+///             callback_reason() will be FL_TREE_REASON_SELECTION_CHANGED,
+///             callback_item() will be NULL
+/// \returns The number of items whose selection states were changed, if any.
+/// \see select_range(), select_all()
+/// \version 1.4.0
+///
+int Fl_Tree::select_if(Fl_Tree_Item_Predicate *pred, void *data, int val,
+                       Fl_Tree_Item *item, int docallback) {
+  item = item ? item : _root;			// NULL? use root()
+  if ( ! item ) return(0);
+  int changed = select_subtree_if(item, pred, data, val);
+  if ( changed ) {
+    set_changed();
+    redraw();
+    if ( docallback ) {
+      do_callback_for_item(0, FL_TREE_REASON_SELECTION_CHANGED);
+    }
+  }
+  return(changed);
+}
+
 /// Get the item that currently has keyboard focus.
 Fl_Tree_Item* Fl_Tree::get_item_focus() const {
   return(_item_focus);
@@ -2348,7 +2749,8 @@ void Fl_Tree::item_draw_mode(int mode) {
 int Fl_Tree::displayed(Fl_Tree_Item *item) {
   item = item ? item : first();
   if (!item) return(0);
-  return( (item->y() >= y()) && (item->y() <= (y()+h()-item->h())) ? 1 : 0);
+  int Y = item_y(item);
+  return( (Y >= y()) && (Y <= (y()+h()-item->calc_item_height(_prefs))) ? 1 : 0);
 }
 
 /// Adjust the vertical scrollbar so that \p 'item' is visible
@@ -2368,7 +2770,7 @@ int Fl_Tree::displayed(Fl_Tree_Item *item) {
 void Fl_Tree::show_item(Fl_Tree_Item *item, int yoff) {
   item = item ? item : first();
   if (!item) return;
-  int newval = item->y() - y() - yoff + (int)_vscroll->value();
+  int newval = item_y(item) - y() - yoff + (int)_vscroll->value();
   if ( newval < _vscroll->minimum() ) newval = (int)_vscroll->minimum();
   if ( newval > _vscroll->maximum() ) newval = (int)_vscroll->maximum();
   _vscroll->value(newval);
@@ -2405,7 +2807,7 @@ void Fl_Tree::show_item_top(Fl_Tree_Item *item) {
 ///
 void Fl_Tree::show_item_middle(Fl_Tree_Item *item) {
   item = item ? item : first();
-  if (item) show_item(item, (_tih/2)-(item->h()/2));
+  if (item) show_item(item, (_tih/2)-(item->calc_item_height(_prefs)/2));
 }
 
 /// Adjust the vertical scrollbar so that \p 'item' is at the bottom of the display.
@@ -2414,7 +2816,7 @@ void Fl_Tree::show_item_middle(Fl_Tree_Item *item) {
 ///
 void Fl_Tree::show_item_bottom(Fl_Tree_Item *item) {
   item = item ? item : first();
-  if (item) show_item(item, _tih-item->h());
+  if (item) show_item(item, _tih-item->calc_item_height(_prefs));
 }
 
 /// Displays \p 'item', scrolling the tree as necessary.
@@ -2600,6 +3002,8 @@ void Fl_Tree::callback_reason(Fl_Tree_Reason reason) {
          case   FL_TREE_REASON_SELECTED: ..item was selected..
          case FL_TREE_REASON_RESELECTED: ..item was reselected (double-clicked, etc)..
          case FL_TREE_REASON_DESELECTED: ..item was deselected..
+         case FL_TREE_REASON_SELECTION_CHANGED: ..several items were (de)selected, e.g. by select_range()..
+         case FL_TREE_REASON_OPEN_CHANGED: ..several items were opened/closed, e.g. by open_all()..
      }
  }
  :
@@ -2673,10 +3077,31 @@ void Fl_Tree::fix_scrollbar_order() {
 }
 
 /// Schedule tree to recalc the entire tree size.
+///
+/// This also discards the size of each item's subtree that the tree
+/// caches to avoid walking unchanged or off screen parts of the tree,
+/// so all items will be walked again by the next calc_tree().
+/// Changes made through Fl_Tree_Item's methods (e.g. label(), open(), add())
+/// only discard the cached sizes of the affected item and its parents.
+///
 /// \note Must be using FLTK ABI 1.3.3 or higher for this to be effective.
 ///
 void Fl_Tree::recalc_tree() {
   _tree_w = _tree_h = -1;
+  if ( ++_subtree_gen == 0 ) _subtree_gen = 1;	// 0 is reserved for 'not cached'
+}
+
+// Internal: Return the current y position of \p 'item'.
+//
+//    Unlike item->y(), which is updated by draw() only for items that
+//    aren't scrolled off screen, this is computed from the items' cached
+//    subtree heights, and takes into account the current scroll position.
+//
+int Fl_Tree::item_y(Fl_Tree_Item *item) {
+  if ( _tree_w == -1 ) calc_tree();	// make sure the cached heights are current
+  int offset = item->calc_item_offset();
+  if ( offset < 0 ) return(item->y());	// shouldn't happen; use last drawn position
+  return(_tiy + _prefs.margintop() - (int)_vscroll->value() + offset);
 }
 
 //
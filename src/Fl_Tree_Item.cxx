@@ -4,6 +4,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 #include <FL/Fl_Widget.H>
 #include <FL/Fl_Tree_Item.H>
@@ -34,6 +35,344 @@ static int event_inside(const int xywh[4]) {
   return(Fl::event_inside(xywh[0],xywh[1],xywh[2],xywh[3]));
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Memory management
+//
+//    A tree may have millions of items, most of which have the same label
+//    attributes, and many of which have the same label (e.g. "README").
+//    So items share their labels and label attributes with other items
+//    of the same tree where possible, and the items a tree makes itself
+//    are allocated from its pool rather than one by one.
+//
+//    Each tree has its own pool and tables (see Fl_Tree_Item_Store), so
+//    different trees can be built by different threads. Items without a
+//    tree (deprecated Fl_Tree_Item(const Fl_Tree_Prefs&)) share one store.
+//
+
+// Internal: A label string shared by all items with the same label.
+//    Item labels point to 'str'.
+//
+struct Fl_Tree_Label {
+  unsigned int   refs;		// #items using this label
+  unsigned int   hash;		// hash of label
+  Fl_Tree_Label *next;		// next label in same hash bucket
+  char           str[1];	// the label (allocated to size)
+};
+
+// Internal: Precedes each item in memory, to tell where it was allocated.
+union Fl_Tree_Item_Header {
+  Fl_Tree_Item_Store *store;	// store whose pool has the item, 0 if on the heap
+  double align;			// (alignment)
+};
+
+// Internal: A slot of the item pool.
+#define ITEMS_PER_CHUNK 256
+struct Fl_Tree_Item_Slot {
+  Fl_Tree_Item_Header header;
+  union {
+    Fl_Tree_Item_Slot *next;			// next free slot
+    char item[sizeof(Fl_Tree_Item)];		// the item
+    double align;				// (alignment)
+  } u;
+};
+struct Fl_Tree_Item_Chunk {
+  Fl_Tree_Item_Chunk *next;			// next chunk
+  Fl_Tree_Item_Slot slots[ITEMS_PER_CHUNK];
+};
+
+// Internal: The memory shared by the items of one tree.
+//    The item pool: items are carved out of chunks of ITEMS_PER_CHUNK items
+//    and recycled through a free list; the chunks are freed when the last
+//    pooled item is deleted. The hash tables of shared labels and Styles.
+//
+//    Reference counted: the tree, each of its items and each pooled item's
+//    memory hold a reference, so items that outlive their tree can still
+//    release their labels and styles. Freed with the last reference.
+//    Not locked: a tree and its items must be used by one thread at a time.
+//    All zero when empty, so it can be allocated with calloc().
+//
+class Fl_Tree_Item_Store {
+  typedef Fl_Tree_Item::Style Style;
+  Fl_Tree_Label **label_table;		// hash table of labels
+  int label_table_size;			// #buckets (power of 2)
+  int label_table_count;		// #labels
+  Style **style_table;			// hash table of styles
+  int style_table_size;			// #buckets (power of 2)
+  int style_table_count;		// #styles
+  Style *last_style;			// most recently interned style
+  Fl_Tree_Item_Chunk *item_chunks;	// all chunks
+  Fl_Tree_Item_Slot *item_free;		// free slots
+  int item_count;			// #pooled items in use
+  int refs;				// #references (tree, items, pooled memory)
+
+  static unsigned int style_hash(const Style &s) {
+    unsigned int h = (unsigned int)s.labelfont;
+    h = h * 31 + (unsigned int)s.labelsize;
+    h = h * 31 + (unsigned int)s.labelfgcolor;
+    h = h * 31 + (unsigned int)s.labelbgcolor;
+    h = h * 31 + (unsigned int)(fl_intptr_t)s.usericon;
+    h = h * 31 + (unsigned int)(fl_intptr_t)s.userdeicon;
+    return h ^ (h >> 16);
+  }
+  static int style_equal(const Style &a, const Style &b) {
+    return(a.labelfont    == b.labelfont    && a.labelsize    == b.labelsize &&
+           a.labelfgcolor == b.labelfgcolor && a.labelbgcolor == b.labelbgcolor &&
+           a.usericon     == b.usericon     && a.userdeicon   == b.userdeicon);
+  }
+  void free_chunks();
+public:
+  Fl_Tree *tree;			// the tree, 0 once it's deleted
+  const char *label_intern(const char *name);
+  void label_release(const char *name);
+  const Style *style_intern(const Style &val);
+  void style_release(const Style *style);
+  void *alloc_item();
+  void free_item(Fl_Tree_Item_Slot *slot);
+  void clear();
+  void ref() { refs++; }
+  void unref();
+};
+
+static Fl_Tree_Item_Store no_tree_store;	// for items without a tree
+
+static unsigned int string_hash(const char *s) {
+  unsigned int h = 2166136261U;			// FNV-1a
+  for ( ; *s; s++ ) { h ^= (unsigned char)*s; h *= 16777619U; }
+  return h;
+}
+
+// Return the shared copy of label 'name', adding it if needed.
+const char *Fl_Tree_Item_Store::label_intern(const char *name) {
+  if ( !name ) return(0);
+  unsigned int hash = string_hash(name);
+  if ( label_table ) {
+    for ( Fl_Tree_Label *l = label_table[hash & (label_table_size-1)]; l; l = l->next ) {
+      if ( l->hash == hash && strcmp(l->str, name) == 0 ) {
+        l->refs++;
+        return(l->str);
+      }
+    }
+  }
+  if ( label_table_count >= label_table_size ) {	// grow table
+    int newsize = label_table_size ? label_table_size * 2 : 256;
+    Fl_Tree_Label **newtable = (Fl_Tree_Label**)calloc(newsize, sizeof(Fl_Tree_Label*));
+    for ( int t=0; t<label_table_size; t++ ) {
+      Fl_Tree_Label *next;
+      for ( Fl_Tree_Label *l = label_table[t]; l; l = next ) {
+        next = l->next;
+        l->next = newtable[l->hash & (newsize-1)];
+        newtable[l->hash & (newsize-1)] = l;
+      }
+    }
+    free((void*)label_table);
+    label_table = newtable;
+    label_table_size = newsize;
+  }
+  size_t len = strlen(name);
+  Fl_Tree_Label *l = (Fl_Tree_Label*)malloc(sizeof(Fl_Tree_Label) + len);
+  l->refs = 1;
+  l->hash = hash;
+  memcpy(l->str, name, len+1);
+  l->next = label_table[hash & (label_table_size-1)];
+  label_table[hash & (label_table_size-1)] = l;
+  label_table_count++;
+  return(l->str);
+}
+
+// Release a label returned by label_intern(), freeing it if unused.
+void Fl_Tree_Item_Store::label_release(const char *name) {
+  if ( !name ) return;
+  Fl_Tree_Label *label = (Fl_Tree_Label*)(name - offsetof(Fl_Tree_Label, str));
+  if ( --label->refs > 0 ) return;
+  Fl_Tree_Label **lp = &label_table[label->hash & (label_table_size-1)];
+  while ( *lp != label ) lp = &(*lp)->next;
+  *lp = label->next;
+  free((void*)label);
+  if ( --label_table_count == 0 ) {		// no labels left? free table
+    free((void*)label_table);
+    label_table = 0;
+    label_table_size = 0;
+  }
+}
+
+// Return the shared style with the values of 'val', adding it if needed.
+const Fl_Tree_Item::Style *Fl_Tree_Item_Store::style_intern(const Style &val) {
+  if ( last_style && style_equal(*last_style, val) ) {	// common case: same as last
+    last_style->refs++;
+    return(last_style);
+  }
+  unsigned int h = style_hash(val);
+  if ( style_table ) {
+    for ( Style *st = style_table[h & (style_table_size-1)]; st; st = st->next ) {
+      if ( style_equal(*st, val) ) { st->refs++; return(last_style = st); }
+    }
+  }
+  if ( style_table_count >= style_table_size ) {	// grow table
+    int newsize = style_table_size ? style_table_size * 2 : 16;
+    Style **newtable = (Style**)calloc(newsize, sizeof(Style*));
+    for ( int t=0; t<style_table_size; t++ ) {
+      Style *next;
+      for ( Style *st = style_table[t]; st; st = next ) {
+        next = st->next;
+        st->next = newtable[style_hash(*st) & (newsize-1)];
+        newtable[style_hash(*st) & (newsize-1)] = st;
+      }
+    }
+    free((void*)style_table);
+    style_table = newtable;
+    style_table_size = newsize;
+  }
+  Style *st = (Style*)malloc(sizeof(Style));
+  *st = val;
+  st->refs = 1;
+  st->next = style_table[h & (style_table_size-1)];
+  style_table[h & (style_table_size-1)] = st;
+  style_table_count++;
+  return(last_style = st);
+}
+
+// Release a style returned by style_intern(), freeing it if unused.
+void Fl_Tree_Item_Store::style_release(const Style *style) {
+  Style *st = (Style*)style;
+  if ( --st->refs > 0 ) return;
+  if ( st == last_style ) last_style = 0;
+  Style **sp = &style_table[style_hash(*st) & (style_table_size-1)];
+  while ( *sp != st ) sp = &(*sp)->next;
+  *sp = st->next;
+  free((void*)st);
+  if ( --style_table_count == 0 ) {		// no styles left? free table
+    free((void*)style_table);
+    style_table = 0;
+    style_table_size = 0;
+  }
+}
+
+// Return memory for an item from the pool, or 0 if out of memory.
+void *Fl_Tree_Item_Store::alloc_item() {
+  if ( !item_free ) {				// no free slots? add chunk
+    Fl_Tree_Item_Chunk *chunk = (Fl_Tree_Item_Chunk*)malloc(sizeof(Fl_Tree_Item_Chunk));
+    if ( !chunk ) return(0);
+    chunk->next = item_chunks;
+    item_chunks = chunk;
+    for ( int t=ITEMS_PER_CHUNK-1; t>=0; t-- ) {
+      chunk->slots[t].u.next = item_free;
+      item_free = &chunk->slots[t];
+    }
+  }
+  Fl_Tree_Item_Slot *slot = item_free;
+  item_free = slot->u.next;
+  item_count++;
+  ref();					// pooled memory keeps the pool alive
+  slot->header.store = this;
+  return((void*)slot->u.item);
+}
+
+// Return a slot to the pool, freeing the pool if it was the last item.
+void Fl_Tree_Item_Store::free_item(Fl_Tree_Item_Slot *slot) {
+  slot->u.next = item_free;
+  item_free = slot;
+  if ( --item_count == 0 ) free_chunks();	// no items left? free pool
+  unref();
+}
+
+void Fl_Tree_Item_Store::free_chunks() {
+  while ( item_chunks ) {
+    Fl_Tree_Item_Chunk *next = item_chunks->next;
+    free((void*)item_chunks);
+    item_chunks = next;
+  }
+  item_free = 0;
+  item_count = 0;
+}
+
+// Free everything. Only called when no tree or item uses the store.
+void Fl_Tree_Item_Store::clear() {
+  int t;
+  for ( t=0; t<label_table_size; t++ ) {
+    Fl_Tree_Label *next;
+    for ( Fl_Tree_Label *l = label_table[t]; l; l = next ) { next = l->next; free((void*)l); }
+  }
+  free((void*)label_table);
+  for ( t=0; t<style_table_size; t++ ) {
+    Style *next;
+    for ( Style *st = style_table[t]; st; st = next ) { next = st->next; free((void*)st); }
+  }
+  free((void*)style_table);
+  free_chunks();
+  memset((void*)this, 0, sizeof(*this));
+}
+
+// Drop a reference, freeing the store with the last one.
+//    The store for items without a tree is never freed.
+void Fl_Tree_Item_Store::unref() {
+  if ( this == &no_tree_store || --refs > 0 ) return;
+  clear();
+  free((void*)this);
+}
+
+// Internal: Return the store of 'tree', making it on first use.
+//    The tree holds the first reference.
+Fl_Tree_Item_Store *Fl_Tree_Item::store(Fl_Tree *tree) {
+  if ( !tree ) return(&no_tree_store);
+  if ( !tree->_store ) {
+    tree->_store = (Fl_Tree_Item_Store*)calloc(1, sizeof(Fl_Tree_Item_Store));
+    tree->_store->tree = tree;
+    tree->_store->ref();
+  }
+  return(tree->_store);
+}
+
+// Internal: Drop the tree's reference to its store. Called by the tree
+//    after deleting its items. Items still alive keep the store.
+void Fl_Tree_Item::release_store(Fl_Tree_Item_Store *store) {
+  if ( !store ) return;
+  store->tree = 0;
+  store->unref();
+}
+
+// Internal: Change the item's style to a shared copy of 'val'.
+void Fl_Tree_Item::style(const Style &val) {
+  const Style *old = _style;
+  _style = _store->style_intern(val);
+  _store->style_release(old);
+}
+
+/// Allocates memory for an item on the heap.
+/// This is what 'new Fl_Tree_Item(..)' and 'new MyItem(..)' use.
+///
+void *Fl_Tree_Item::operator new(size_t size) {
+  Fl_Tree_Item_Header *h = (Fl_Tree_Item_Header*)::operator new(sizeof(Fl_Tree_Item_Header) + size);
+  h->store = 0;
+  return((void*)(h + 1));
+}
+
+/// Allocates memory for an item of \p 'tree' from the tree's pool.
+/// This makes creating and deleting large numbers of items much faster
+/// than one malloc() per item. Fl_Tree uses 'new(tree) Fl_Tree_Item(tree)'
+/// for the items it makes itself. Items of derived classes, which are
+/// larger, are allocated on the heap.
+///
+void *Fl_Tree_Item::operator new(size_t size, Fl_Tree *tree) {
+  if ( !tree || size != sizeof(Fl_Tree_Item) )	// derived class?
+    return(operator new(size));
+  void *p = store(tree)->alloc_item();
+  return(p ? p : operator new(size));		// (throws)
+}
+
+/// Returns memory allocated by either operator new() to the heap or pool.
+void Fl_Tree_Item::operator delete(void *p) {
+  if ( !p ) return;
+  Fl_Tree_Item_Header *h = (Fl_Tree_Item_Header*)p - 1;
+  if ( h->store ) h->store->free_item((Fl_Tree_Item_Slot*)h);
+  else ::operator delete((void*)h);
+}
+
+/// Returns memory allocated by operator new(size_t, Fl_Tree*) if the
+/// constructor throws.
+void Fl_Tree_Item::operator delete(void *p, Fl_Tree *) {
+  operator delete(p);
+}
+
 /// Constructor.
 /// Makes a new instance of Fl_Tree_Item using defaults from \p 'prefs'.
 /// \deprecated in 1.3.3 ABI -- you must use Fl_Tree_Item(Fl_Tree*) for proper horizontal scrollbar behavior.
@@ -47,27 +386,32 @@ Fl_Tree_Item::Fl_Tree_Item(const Fl_Tree_Prefs &prefs) {
 //
 void Fl_Tree_Item::_Init(const Fl_Tree_Prefs &prefs, Fl_Tree *tree) {
   _tree         = tree;
+  _store        = store(tree);
+  _store->ref();
   _label        = 0;
-  _labelfont    = prefs.labelfont();
-  _labelsize    = prefs.labelsize();
-  _labelfgcolor = prefs.labelfgcolor();
-  _labelbgcolor = prefs.labelbgcolor();
+  Style style;
+  style.labelfont    = prefs.labelfont();
+  style.labelsize    = prefs.labelsize();
+  style.labelfgcolor = prefs.labelfgcolor();
+  style.labelbgcolor = prefs.labelbgcolor();
+  style.usericon     = 0;
+  style.userdeicon   = 0;
+  _style        = _store->style_intern(style);
   _widget       = 0;
   _flags        = OPEN|VISIBLE|ACTIVE;
+  _subtree_h    = 0;
+  _subtree_w    = 0;
+  _subtree_y    = 0;
+  _subtree_gen  = 0;			// no cached subtree geometry yet
+  _position     = -1;			// set by update_prev_next()
   _xywh[0]      = 0;
   _xywh[1]      = 0;
   _xywh[2]      = 0;
   _xywh[3]      = 0;
-  _collapse_xywh[0] = 0;
-  _collapse_xywh[1] = 0;
-  _collapse_xywh[2] = 0;
-  _collapse_xywh[3] = 0;
   _label_xywh[0]    = 0;
   _label_xywh[1]    = 0;
   _label_xywh[2]    = 0;
   _label_xywh[3]    = 0;
-  _usericon         = 0;
-  _userdeicon       = 0;
   _userdata         = 0;
   _parent           = 0;
   _children.manage_item_destroy(1);	// let array's dtor manage destroying Fl_Tree_Items
@@ -89,42 +433,42 @@ Fl_Tree_Item::Fl_Tree_Item(Fl_Tree *tree) {
 
 // DTOR
 Fl_Tree_Item::~Fl_Tree_Item() {
-  if ( _label ) { 
-    free((void*)_label);
-    _label = 0;
-  }
+  Fl_Tree *tree = _store->tree;	// 0 if our tree was deleted before us
+  _store->label_release(_label);	// shared with other items
+  _label = 0;
+  _store->style_release(_style);	// icons: user handled allocation
+  _style = 0;
+  _store->unref();		// may free it, if our tree is gone
+  _store = 0;
   _widget = 0;			// Fl_Group will handle destruction
-  _usericon = 0;		// user handled allocation
-  _userdeicon = 0;		// user handled allocation
   // focus item? set to null
-  if ( _tree && this == _tree->_item_focus )
-    { _tree->_item_focus = 0; }
+  if ( tree && this == tree->_item_focus )
+    { tree->_item_focus = 0; }
   //_children.clear();		// array's destructor handles itself
 }
 
 /// Copy constructor.
 Fl_Tree_Item::Fl_Tree_Item(const Fl_Tree_Item *o) {
   _tree             = o->_tree;
-  _label        = o->label() ? strdup(o->label()) : 0;
-  _labelfont    = o->labelfont();
-  _labelsize    = o->labelsize();
-  _labelfgcolor = o->labelfgcolor();
-  _labelbgcolor = o->labelbgcolor();
+  _store            = o->_store;
+  _store->ref();
+  _label        = _store->label_intern(o->label());
+  _style        = _store->style_intern(*o->_style);
   _widget       = o->widget();
   _flags        = o->_flags;
+  _subtree_h    = 0;
+  _subtree_w    = 0;
+  _subtree_y    = 0;
+  _subtree_gen  = 0;			// no cached subtree geometry yet
+  _position     = -1;			// set by update_prev_next()
   _xywh[0]      = o->_xywh[0];
   _xywh[1]      = o->_xywh[1];
   _xywh[2]      = o->_xywh[2];
   _xywh[3]      = o->_xywh[3];
-  _collapse_xywh[0] = o->_collapse_xywh[0];
-  _collapse_xywh[1] = o->_collapse_xywh[1];
-  _collapse_xywh[2] = o->_collapse_xywh[2];
-  _collapse_xywh[3] = o->_collapse_xywh[3];
   _label_xywh[0]    = o->_label_xywh[0];
   _label_xywh[1]    = o->_label_xywh[1];
   _label_xywh[2]    = o->_label_xywh[2];
   _label_xywh[3]    = o->_label_xywh[3];
-  _usericon         = o->usericon();
   _userdata         = o->user_data();
   _parent           = o->_parent;
   _prev_sibling     = 0;		// do not copy ptrs! use update_prev_next()
@@ -153,10 +497,16 @@ void Fl_Tree_Item::show_self(const char *indent) const {
 
 /// Set the label to \p 'name'.
 /// Makes and manages an internal copy of \p 'name'.
+/// Items with the same label share one copy, so the string returned
+/// by label() must not be modified.
 ///
 void Fl_Tree_Item::label(const char *name) {
-  if ( _label ) { free((void*)_label); _label = 0; }
-  _label = name ? strdup(name) : 0;
+  // Label is the key of our parent's child index: rehash if we're in it
+  int indexed = _parent ? _parent->_children.index_remove(this) : 0;
+  const char *old = _label;
+  _label = _store->label_intern(name);	// (before release, in case name==old)
+  _store->label_release(old);
+  if ( indexed ) _parent->_children.index_add(this);
   recalc_tree();		// may change label geometry
 }
 
@@ -165,6 +515,85 @@ const char *Fl_Tree_Item::label() const {
   return(_label);
 }
 
+/// Set item's label font face.
+void Fl_Tree_Item::labelfont(Fl_Font val) {
+  Style st = *_style;
+  st.labelfont = val;
+  style(st);
+  recalc_tree();		// may change tree geometry
+}
+
+/// Set item's label font size.
+void Fl_Tree_Item::labelsize(Fl_Fontsize val) {
+  Style st = *_style;
+  st.labelsize = val;
+  style(st);
+  recalc_tree();		// may change tree geometry
+}
+
+/// Set item's label foreground text color.
+void Fl_Tree_Item::labelfgcolor(Fl_Color val) {
+  Style st = *_style;
+  st.labelfgcolor = val;
+  style(st);
+}
+
+/// Set item's label background color.
+/// A special case is made for color 0xffffffff which uses the parent tree's bg color.
+void Fl_Tree_Item::labelbgcolor(Fl_Color val) {
+  Style st = *_style;
+  st.labelbgcolor = val;
+  style(st);
+}
+
+/// Set the item's user icon to an Fl_Image. Use '0' to disable.
+/// No internal copy is made, caller must manage icon's memory.
+///
+/// Note, if you expect your items to be deactivated(),
+/// use userdeicon(Fl_Image*) to set up a 'grayed out' version of your icon
+/// to be used for display.
+///
+/// \see userdeicon(Fl_Image*)
+///
+void Fl_Tree_Item::usericon(Fl_Image *val) {
+  Style st = *_style;
+  st.usericon = val;
+  style(st);
+  recalc_tree();		// may change tree geometry
+}
+
+/// Set the usericon to draw when the item is deactivated. Use '0' to disable.
+/// No internal copy is made; caller must manage icon's memory.
+///
+/// To create a typical 'grayed out' version of your usericon image,
+/// you can do the following:
+///
+/// \code
+///      // Create tree + usericon for items
+///      Fl_Tree *tree = new Fl_Tree(..);
+///      Fl_Image *usr_icon = new Fl_Pixmap(..); // your usericon
+///      Fl_Image *de_icon  = usr_icon->copy();  // make a copy, and..
+///      de_icon->inactive();                    // make it 'grayed out'
+///      ...
+///      for ( .. ) {                 // item loop..
+///        item = tree->add("...");   // create new item
+///        item->usericon(usr_icon);  // assign usericon to items
+///        item->userdeicon(de_icon); // assign userdeicon to items
+///        ..
+///      }
+/// \endcode
+///
+/// In the above example, the app should 'delete' the two icons
+/// when they're no longer needed (e.g. after the tree is destroyed)
+///
+/// \version 1.3.4
+///
+void Fl_Tree_Item::userdeicon(Fl_Image *val) {
+  Style st = *_style;
+  st.userdeicon = val;
+  style(st);
+}
+
 /// Return const child item for the specified 'index'.
 const Fl_Tree_Item *Fl_Tree_Item::child(int index) const {
   return(_children[index]);
@@ -183,13 +612,8 @@ void Fl_Tree_Item::clear_children() {
 /// \version 1.3.0 release
 ///
 int Fl_Tree_Item::find_child(const char *name) {
-  if ( name ) {
-    for ( int t=0; t<children(); t++ )
-      if ( child(t)->label() )
-        if ( strcmp(child(t)->label(), name) == 0 )
-          return(t);
-  }
-  return(-1);
+  Fl_Tree_Item *item = _children.find_label(name);
+  return(item ? find_child(item) : -1);
 }
 
 /// Return the /immediate/ child of current item
@@ -199,12 +623,7 @@ int Fl_Tree_Item::find_child(const char *name) {
 /// \version 1.3.3
 ///
 const Fl_Tree_Item* Fl_Tree_Item::find_child_item(const char *name) const {
-  if ( name )
-    for ( int t=0; t<children(); t++ )
-      if ( child(t)->label() )
-        if ( strcmp(child(t)->label(), name) == 0 )
-          return(child(t));
-  return(0);
+  return(_children.find_label(name));
 }
 
 /// Non-const version of Fl_Tree_Item::find_child_item(const char *name) const.
@@ -222,18 +641,12 @@ Fl_Tree_Item* Fl_Tree_Item::find_child_item(const char *name) {
 /// \version 1.3.0 release
 ///
 const Fl_Tree_Item *Fl_Tree_Item::find_child_item(char **arr) const {
-  for ( int t=0; t<children(); t++ ) {
-    if ( child(t)->label() ) {
-      if ( strcmp(child(t)->label(), *arr) == 0 ) {	// match?
-        if ( *(arr+1) ) {				// more in arr? descend
-          return(_children[t]->find_child_item(arr+1));
-        } else {					// end of arr? done
-          return(_children[t]);
-        }
-      }
-    }
+  const Fl_Tree_Item *item = this;
+  for ( ; *arr; ++arr ) {				// descend one level per name
+    if ( (item = item->_children.find_label(*arr)) == 0 )
+      return(0);					// no match? done
   }
-  return(0);
+  return(item == this ? 0 : item);
 }
 
 /// Non-const version of Fl_Tree_Item::find_child_item(char **arr) const.
@@ -274,6 +687,11 @@ Fl_Tree_Item *Fl_Tree_Item::find_item(char **names) {
 /// \returns the index, or -1 if not found.
 ///
 int Fl_Tree_Item::find_child(Fl_Tree_Item *item) {
+  // Items know their position among their parent's children
+  _children.update_positions();
+  if ( item && item->_position >= 0 && item->_position < children() &&
+       child(item->_position) == item )
+    return(item->_position);
   for ( int t=0; t<children(); t++ )
     if ( item == child(t) )
       return(t);
@@ -292,11 +710,23 @@ Fl_Tree_Item *Fl_Tree_Item::add(const Fl_Tree_Prefs &prefs,
   return(add(prefs, new_label, (Fl_Tree_Item*)0));
 }
 
+// Internal: Does an item labeled \p 'label' sort after \p 'new_label'?
+//    Unlabeled items never do.
+//
+static int sorts_after(const char *label, const char *new_label, Fl_Tree_Sort order) {
+  if ( !label ) return(0);
+  int cmp = strcmp(label, new_label);
+  return(order == FL_TREE_SORT_ASCENDING ? cmp > 0 : cmp < 0);
+}
+
 /// Add \p 'item' as immediate child with \p 'new_label'
 /// and defaults from \p 'prefs'.
 /// If \p 'item' is NULL, a new item is created.
 /// An internally managed copy is made of the label string.
 /// Adds the item based on the value of prefs.sortorder().
+/// When sorting, the position is found with a binary search, which
+/// assumes the children are already in that order (as they are when
+/// they were all added with the same sortorder()).
 /// \returns the item added
 /// \version 1.3.3
 ///
@@ -304,7 +734,7 @@ Fl_Tree_Item *Fl_Tree_Item::add(const Fl_Tree_Prefs &prefs,
 			        const char *new_label,
 				Fl_Tree_Item *item) {
   if ( !item )
-    { item = new Fl_Tree_Item(_tree); item->label(new_label); }
+    { item = new(_tree) Fl_Tree_Item(_tree); item->label(new_label); }
   recalc_tree();		// may change tree geometry
   item->_parent = this;
   switch ( prefs.sortorder() ) {
@@ -312,26 +742,18 @@ Fl_Tree_Item *Fl_Tree_Item::add(const Fl_Tree_Prefs &prefs,
       _children.add(item);
       return(item);
     }
-    case FL_TREE_SORT_ASCENDING: {
-      for ( int t=0; t<_children.total(); t++ ) {
-        Fl_Tree_Item *c = _children[t];
-        if ( c->label() && strcmp(c->label(), new_label) > 0 ) {
-          _children.insert(t, item);
-          return(item);
-        }
-      }
-      _children.add(item);
-      return(item);
-    }
+    case FL_TREE_SORT_ASCENDING:
     case FL_TREE_SORT_DESCENDING: {
-      for ( int t=0; t<_children.total(); t++ ) {
-        Fl_Tree_Item *c = _children[t];
-        if ( c->label() && strcmp(c->label(), new_label) < 0 ) {
-          _children.insert(t, item);
-          return(item);
-        }
+      // Binary search for the first child that sorts after the new label
+      int lo = 0, hi = _children.total();
+      while ( lo < hi ) {
+        int mid = (lo + hi) / 2;
+        if ( sorts_after(_children[mid]->label(), new_label, prefs.sortorder()) )
+          hi = mid;
+        else
+          lo = mid + 1;
       }
-      _children.add(item);
+      _children.insert(lo, item);	// (appends if lo == total)
       return(item);
     }
   }
@@ -392,7 +814,7 @@ Fl_Tree_Item *Fl_Tree_Item::add(const Fl_Tree_Prefs &prefs,
 /// \returns the new item inserted.
 ///
 Fl_Tree_Item *Fl_Tree_Item::insert(const Fl_Tree_Prefs &prefs, const char *new_label, int pos) {
-  Fl_Tree_Item *item = new Fl_Tree_Item(_tree);
+  Fl_Tree_Item *item = new(_tree) Fl_Tree_Item(_tree);
   item->label(new_label);
   item->_parent = this;
   _children.insert(pos, item);
@@ -431,6 +853,7 @@ Fl_Tree_Item *Fl_Tree_Item::insert_above(const Fl_Tree_Prefs &prefs, const char
 Fl_Tree_Item* Fl_Tree_Item::deparent(int pos) {
   Fl_Tree_Item *orphan = _children[pos];
   if ( _children.deparent(pos) < 0 ) return NULL;
+  recalc_tree();		// may change tree geometry
   return orphan;
 }
 
@@ -445,6 +868,7 @@ int Fl_Tree_Item::reparent(Fl_Tree_Item *newchild, int pos) {
   int ret;
   if ( (ret = _children.reparent(newchild, this, pos)) < 0 ) return ret;
   newchild->parent(this);		// take custody
+  recalc_tree();		// may change tree geometry
   return 0;
 }
 
@@ -643,16 +1067,11 @@ int Fl_Tree_Item::remove_child(Fl_Tree_Item *item) {
 /// \version 1.3.3
 ///
 int Fl_Tree_Item::remove_child(const char *name) {
-  for ( int t=0; t<children(); t++ ) {
-    if ( child(t)->label() ) {
-      if ( strcmp(child(t)->label(), name) == 0 ) {
-        _children.remove(t);
-	recalc_tree();		// may change tree geometry
-        return(0);
-      }
-    }
-  }
-  return(-1);
+  int t = find_child(name);
+  if ( t < 0 ) return(-1);
+  _children.remove(t);
+  recalc_tree();		// may change tree geometry
+  return(0);
 }
 
 /// Swap two of our children, given two child index values \p 'ax' and \p 'bx'.
@@ -752,28 +1171,50 @@ void Fl_Tree_Item::draw_vertical_connector(int x, int y1, int y2, const Fl_Tree_
 /// \version 1.3.3 ABI feature
 ///
 const Fl_Tree_Item *Fl_Tree_Item::find_clicked(const Fl_Tree_Prefs &prefs, int yonly) const {
+  int Y = _xywh[1];				// our position as of last draw()
+  return(find_clicked(prefs, yonly, Y));
+}
+
+// Internal: find_clicked() for an item whose top is at \p 'Y'.
+//    Walks the items the same way draw() does, advancing Y past each item,
+//    and skipping subtrees that don't span the event's y position using
+//    their cached height. That way, the items scrolled off screen, whose
+//    xywh were not updated by the last draw(), are never considered.
+//
+const Fl_Tree_Item *Fl_Tree_Item::find_clicked(const Fl_Tree_Prefs &prefs,
+                                               int yonly, int &Y) const {
   if ( ! is_visible() ) return(0);
+  int ey = Fl::event_y();
+  int subtree_y = Y;				// top of our subtree
+  char cached = subtree_cached() && !is_flag(SUBTREE_WIDGETS);
+  if ( cached && ( ey < Y || ey > Y + _subtree_h ) ) {	// event not within our subtree?
+    Y += _subtree_h;				// skip it
+    return(0);
+  }
   if ( is_root() && !prefs.showroot() ) {
     // skip event check if we're root but root not being shown
   } else {
     // See if event is over us
-    if ( yonly ) {
-      if ( Fl::event_y() >= _xywh[1] &&
-           Fl::event_y() <= (_xywh[1]+_xywh[3]) ) {
-        return(this);
-      }
-    } else {
-      if ( event_inside(_xywh) ) {		// event within this item?
+    int H = calc_item_height(prefs);
+    if ( ey >= Y && ey <= (Y+H) ) {
+      if ( yonly || event_inside(_xywh) ) {	// event within this item?
         return(this);				// found
       }
     }
+    Y += H + prefs.linespacing();
   }
-  if ( is_open() ) {				// open? check children of this item
-    for ( int t=0; t<children(); t++ ) {
+  if ( has_children() && is_open() ) {		// open? check children of this item
+    int t = 0;
+    if ( cached ) {				// skip children above the event
+      t = child_at_offset(ey - subtree_y);
+      Y = subtree_y + _children[t]->_subtree_y;
+    }
+    for ( ; t<children(); t++ ) {
       const Fl_Tree_Item *item;
-      if ( (item = _children[t]->find_clicked(prefs, yonly)) != NULL)  // recurse into child for descendents
-        return(item);						       // found?
+      if ( (item = _children[t]->find_clicked(prefs, yonly, Y)) != NULL)  // recurse into child for descendents
+        return(item);							  // found?
     }
+    Y += prefs.openchild_marginbottom();
   }
   return(0);
 }
@@ -838,21 +1279,32 @@ int Fl_Tree_Item::calc_item_height(const Fl_Tree_Prefs &prefs) const {
   if ( ! is_visible() ) return(0);
   int H = 0;
   if ( _label ) {
-    fl_font(_labelfont, _labelsize);	// fl_descent() needs this :/
-    H = _labelsize + fl_descent() + 1;	// at least one pixel space below descender
+    fl_font(_style->labelfont, _style->labelsize);	// fl_descent() needs this :/
+    H = _style->labelsize + fl_descent() + 1;	// at least one pixel space below descender
   }
   if ( widget() &&
        (prefs.item_draw_mode() & FL_TREE_ITEM_HEIGHT_FROM_WIDGET) &&
        H < widget()->h()) {
     H = widget()->h();
   }
-  if ( has_children() && prefs.openicon() && H<prefs.openicon()->h() )
+  if ( has_children_or_lazy() && prefs.openicon() && H<prefs.openicon()->h() )
     H = prefs.openicon()->h();
   if ( usericon() && H<usericon()->h() )
     H = usericon()->h();
   return(H);
 }
 
+// Internal: Calculate the xywh of the item's open/close icon from the
+//    item's xywh, as last set by draw(). Used for mouse click detection.
+//
+void Fl_Tree_Item::calc_collapse_xywh(const Fl_Tree_Prefs &prefs, int xywh[4]) const {
+  int item_y_center = _xywh[1] + (_xywh[3]/2);
+  xywh[2] = prefs.openicon()->w();
+  xywh[0] = _xywh[0] + (xywh[2] + prefs.connectorwidth())/2 - 3;
+  xywh[1] = item_y_center - (prefs.openicon()->h()/2);
+  xywh[3] = prefs.openicon()->h();
+}
+
 // These methods held for 1.3.3 ABI: all need 'tree()' back-reference.
 
 /// Returns the recommended foreground color used for drawing this item.
@@ -860,9 +1312,9 @@ int Fl_Tree_Item::calc_item_height(const Fl_Tree_Prefs &prefs) const {
 /// \version 1.3.3 ABI ABI
 ///
 Fl_Color Fl_Tree_Item::drawfgcolor() const {
-  return is_selected() ? fl_contrast(_labelfgcolor, tree()->selection_color())
-		       : (is_active() && tree()->active_r()) ? _labelfgcolor
-				                             : fl_inactive(_labelfgcolor);
+  return is_selected() ? fl_contrast(_style->labelfgcolor, tree()->selection_color())
+		       : (is_active() && tree()->active_r()) ? _style->labelfgcolor
+				                             : fl_inactive(_style->labelfgcolor);
 }
 
 /// Returns the recommended background color used for drawing this item.
@@ -873,8 +1325,8 @@ Fl_Color Fl_Tree_Item::drawbgcolor() const {
   const Fl_Color unspecified = 0xffffffff;
   return is_selected() ? is_active() && tree()->active_r() ? tree()->selection_color() 
 				                           : fl_inactive(tree()->selection_color())
-		       : _labelbgcolor == unspecified ? tree()->color()
-						      : _labelbgcolor;
+		       : _style->labelbgcolor == unspecified ? tree()->color()
+						      : _style->labelbgcolor;
 }
 
 /// Draw the item content
@@ -966,10 +1418,10 @@ int Fl_Tree_Item::draw_item_content(int render) {
 	 (prefs.item_draw_mode() & FL_TREE_ITEM_DRAW_LABEL_AND_WIDGET) ) ) {
     if ( render ) {
       fl_color(fg);
-      fl_font(_labelfont, _labelsize);
+      fl_font(_style->labelfont, _style->labelsize);
     }
     int lx = label_x()+(_label ? prefs.labelmarginleft() : 0);
-    int ly = label_y()+(label_h()/2)+(_labelsize/2)-fl_descent()/2;
+    int ly = label_y()+(label_h()/2)+(_style->labelsize/2)-fl_descent()/2;
     int lw=0, lh=0;
     fl_measure(_label, lw, lh);		// get box around text (including white space)
     if ( render ) fl_draw(_label, lx, ly);
@@ -1001,6 +1453,28 @@ void Fl_Tree_Item::draw(int X, int &Y, int W, Fl_Tree_Item *itemfocus,
   if ( !is_visible() ) return; 
   int tree_top = tree()->_tiy;
   int tree_bot = tree_top + tree()->_tih;
+
+  // Use our cached subtree size to skip walking the subtree when possible:
+  //   - When just calculating sizes, if nothing in it changed since last time
+  //   - When rendering, if it's entirely scrolled off the viewport
+  //   Subtrees with FLTK widgets are always walked, so that the widgets
+  //   get moved as the tree scrolls (see 'Recalc widget position' below).
+  //   Root is always walked when rendering, it's where find_clicked() starts.
+  //
+  if ( subtree_cached() && !is_flag(SUBTREE_WIDGETS) ) {
+    if ( !render ) {
+      if ( _subtree_w > 0 && X + _subtree_w > tree_item_xmax )
+        tree_item_xmax = X + _subtree_w;
+      Y += _subtree_h;
+      return;
+    }
+    if ( !is_root() && ( (Y + _subtree_h) < tree_top || Y > tree_bot ) ) {
+      Y += _subtree_h;
+      return;
+    }
+  }
+  int subtree_y = Y;			// top of our subtree
+
   int H = calc_item_height(prefs);	// height of item
   int H2 = H + prefs.linespacing();	// height of item with line spacing
 
@@ -1010,18 +1484,14 @@ void Fl_Tree_Item::draw(int X, int &Y, int W, Fl_Tree_Item *itemfocus,
   _xywh[2] = W;
   _xywh[3] = H;
 
-  // Determine collapse icon's xywh
-  //   Note: calculate collapse icon's xywh for possible mouse click detection.
-  //   We don't care about items clipped off the viewport; they won't get mouse events.
+  // Determine collapse icon's position
+  //   Note: event_on_collapse_icon() recalculates this from _xywh
+  //   with calc_collapse_xywh(), so it isn't stored in each item.
   //
   int item_y_center = Y+(H/2);
-  _collapse_xywh[2] = prefs.openicon()->w();
-  int &icon_w = _collapse_xywh[2];
-  _collapse_xywh[0] = X + (icon_w + prefs.connectorwidth())/2 - 3;
-  int &icon_x = _collapse_xywh[0];
-  _collapse_xywh[1] = item_y_center - (prefs.openicon()->h()/2);
-  int &icon_y = _collapse_xywh[1];
-  _collapse_xywh[3] = prefs.openicon()->h();
+  int icon_w = prefs.openicon()->w();
+  int icon_x = X + (icon_w + prefs.connectorwidth())/2 - 3;
+  int icon_y = item_y_center - (prefs.openicon()->h()/2);
 
   // Horizontal connector values
   //   Must calculate these even if(clipped) because 'draw children' code (below)
@@ -1063,7 +1533,7 @@ void Fl_Tree_Item::draw(int X, int &Y, int W, Fl_Tree_Item *itemfocus,
              ? widget()->h() : H;
     if ( _label && 
          (prefs.item_draw_mode() & FL_TREE_ITEM_DRAW_LABEL_AND_WIDGET) ) {
-      fl_font(_labelfont, _labelsize);	// fldescent() needs this
+      fl_font(_style->labelfont, _style->labelsize);	// fldescent() needs this
       int lw=0, lh=0;
       fl_measure(_label,lw,lh);		// get box around text (including white space)
       wx += (lw + prefs.widgetmarginleft());
@@ -1102,7 +1572,7 @@ void Fl_Tree_Item::draw(int X, int &Y, int W, Fl_Tree_Item *itemfocus,
 	  }
 	}
 	// Draw collapse icon
-	if ( render && has_children() && prefs.showcollapse() ) {
+	if ( render && has_children_or_lazy() && prefs.showcollapse() ) {
 	  // Draw icon image
 	  if ( is_open() ) {
 	    if ( active ) prefs.closeicon()->draw(icon_x,icon_y);
@@ -1146,18 +1616,34 @@ void Fl_Tree_Item::draw(int X, int &Y, int W, Fl_Tree_Item *itemfocus,
     }			// end drawthis
   }			// end clipped
   if ( drawthis ) Y += H2;					// adjust Y (even if clipped)
-  // Manage tree_item_xmax
-  if ( xmax > tree_item_xmax )
-    tree_item_xmax = xmax;
+  // Manage subtree's xmax (merged into tree_item_xmax below)
+  int subtree_xmax = xmax;
+  char subtree_widgets = widget() ? 1 : 0;
   // Draw child items (if any)
   if ( has_children() && is_open() ) {
     int child_x = drawthis ? (hconn_x_center - (icon_w/2) + 1)	// offset children to right,
                            : X;					// unless didn't drawthis
     int child_w = W - (child_x-X);
     int child_y_start = Y;
-    for ( int t=0; t<children(); t++ ) {
+    // When rendering a subtree whose size is cached, so are the offsets of
+    //    its children: only walk the children that overlap the viewport.
+    //
+    char skip = render && subtree_cached() && !is_flag(SUBTREE_WIDGETS);
+    int t = 0;
+    if ( skip ) {
+      t = child_at_offset(tree_top - subtree_y);
+      Y = subtree_y + _children[t]->_subtree_y;
+    }
+    for ( ; t<children(); t++ ) {
+      if ( skip && Y > tree_bot ) {			// rest is below the viewport
+        Y = subtree_y + _subtree_h - prefs.openchild_marginbottom();
+        break;
+      }
       int lastchild = ((t+1)==children()) ? 1 : 0;
-      _children[t]->draw(child_x, Y, child_w, itemfocus, tree_item_xmax, lastchild, render);
+      _children[t]->_subtree_y = Y - subtree_y;
+      _children[t]->draw(child_x, Y, child_w, itemfocus, subtree_xmax, lastchild, render);
+      if ( _children[t]->is_visible() && _children[t]->is_flag(SUBTREE_WIDGETS) )
+        subtree_widgets = 1;
     }
     if ( has_children() && is_open() ) {
       Y += prefs.openchild_marginbottom();		// offset below open child tree
@@ -1170,14 +1656,30 @@ void Fl_Tree_Item::draw(int X, int &Y, int W, Fl_Tree_Item *itemfocus,
         draw_vertical_connector(hconn_x, child_y_start, Y, prefs);
     }
   }
+  // Manage tree_item_xmax
+  if ( subtree_xmax > tree_item_xmax )
+    tree_item_xmax = subtree_xmax;
+  // Cache subtree size for the next walk.
+  //   Only when not rendering: when rendering, items scrolled off screen
+  //   don't compute their xmax.
+  //
+  if ( !render ) {
+    _subtree_h = Y - subtree_y;
+    _subtree_w = subtree_xmax > X ? subtree_xmax - X : 0;
+    if ( subtree_widgets ) _flags |= SUBTREE_WIDGETS;
+    else                   _flags &= ~SUBTREE_WIDGETS;
+    _subtree_gen = _tree->_subtree_gen;
+  }
 }
 
 
 /// Was the event on the 'collapse' button of this item?
 ///
 int Fl_Tree_Item::event_on_collapse_icon(const Fl_Tree_Prefs &prefs) const {
-  if ( is_visible() && is_active() && has_children() && prefs.showcollapse() ) {
-    return(event_inside(_collapse_xywh) ? 1 : 0);
+  if ( is_visible() && is_active() && has_children_or_lazy() && prefs.showcollapse() ) {
+    int xywh[4];
+    calc_collapse_xywh(prefs, xywh);
+    return(event_inside(xywh) ? 1 : 0);
   } else {
     return(0);
   }
@@ -1225,6 +1727,32 @@ void Fl_Tree_Item::open() {
   recalc_tree();		// may change tree geometry
 }
 
+/// Mark this item as having children that are loaded on demand.
+///
+/// Such an item is created closed, and drawn with an 'open' icon even
+/// though it has no children yet. The first time it is opened with
+/// Fl_Tree::open() (e.g. by the user clicking the icon), the tree's
+/// populate callback is invoked to add its children.
+/// See Fl_Tree::populate_callback() for details.
+///
+/// Note that Fl_Tree_Item::open() just opens the item, it does not
+/// load the children.
+///
+/// \param[in] val 1: children are loaded on demand, 0: not (default)
+/// \see lazy_children(), is_populated(), Fl_Tree::populate()
+/// \version 1.4.0
+///
+void Fl_Tree_Item::lazy_children(int val) {
+  _flags &= ~(POPULATED|POPULATING|OPEN_PENDING);
+  if ( val ) {
+    _flags |= LAZY_CHILDREN;
+    set_flag(OPEN, 0);		// not loaded yet, so closed (handles recalc_tree())
+  } else {
+    _flags &= ~LAZY_CHILDREN;
+    recalc_tree();		// may change tree geometry
+  }
+}
+
 /// Close this item and all its children.
 void Fl_Tree_Item::close() {
   set_flag(OPEN,0);
@@ -1339,6 +1867,7 @@ Fl_Tree_Item *Fl_Tree_Item::prev_sibling() {
 ///                  Special case if index=-1: become an orphan; null out all parent/sibling associations.
 /// 
 void Fl_Tree_Item::update_prev_next(int index) {
+  _position = index;
   if ( index == -1 ) {	// special case: become an orphan
     _parent = 0;
     _prev_sibling = 0;
@@ -1439,7 +1968,60 @@ int Fl_Tree_Item::visible_r() const {
 /// \version 1.3.3 ABI
 ///
 void Fl_Tree_Item::recalc_tree() {
-  _tree->recalc_tree();
+  // Our cached subtree geometry is stale, and so is that of our parents.
+  //    Don't stop at the first stale item: a closed item may be stale
+  //    while its parents aren't, since they didn't need to walk into it.
+  //
+  for ( Fl_Tree_Item *p = this; p; p = p->_parent )
+    p->_subtree_gen = 0;
+  // Schedule a recalc of the tree's size, but unlike Fl_Tree::recalc_tree()
+  // keep the cached geometry of all other items.
+  _tree->_tree_w = _tree->_tree_h = -1;
+}
+
+/// Internal: Is the cached size of this item's subtree up to date?
+///
+/// The cache is filled in whenever Fl_Tree::calc_tree() walks the item,
+/// invalidated for an item and its parents by recalc_tree(), and for all
+/// items at once by Fl_Tree::recalc_tree().
+///
+int Fl_Tree_Item::subtree_cached() const {
+  return(_subtree_gen == _tree->_subtree_gen ? 1 : 0);
+}
+
+/// Internal: Return the vertical offset of this item from the top of the
+/// root item, as laid out by draw().
+///
+/// This is the sum of the cached offsets of this item and its parents
+/// within their parent's subtree, so it is also valid for items scrolled
+/// off screen, whose y() is not updated by draw(). Only meaningful if the
+/// parents have been walked by Fl_Tree::calc_tree() since they last changed.
+///
+/// \returns the offset in pixels, or -1 if a parent has no cached geometry.
+///
+int Fl_Tree_Item::calc_item_offset() const {
+  int Y = 0;
+  for ( const Fl_Tree_Item *c = this; !c->is_root(); c = c->_parent ) {
+    if ( !c->_parent->subtree_cached() ) return(-1);
+    Y += c->_subtree_y;
+  }
+  return(Y);
+}
+
+/// Internal: Return the index of the last child whose subtree starts above
+/// \p 'offset' pixels from the top of our subtree, or 0 if there is none.
+///
+/// Children's offsets increase with their index, so this is a binary search.
+/// Only meaningful if our subtree_cached() and we have children.
+///
+int Fl_Tree_Item::child_at_offset(int offset) const {
+  int lo = 0, hi = children() - 1;
+  while ( lo < hi ) {
+    int mid = (lo + hi + 1) / 2;
+    if ( _children[mid]->_subtree_y < offset ) lo = mid;
+    else hi = mid - 1;
+  }
+  return(lo);
 }
 
 //
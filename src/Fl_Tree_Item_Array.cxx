@@ -38,6 +38,8 @@ Fl_Tree_Item_Array::Fl_Tree_Item_Array(int new_chunksize) {
   _size      = 0;
   _flags     = 0;
   _chunksize = new_chunksize;
+  _index     = 0;
+  _stale     = 0;
 }
 
 /// Destructor. Calls each item's destructor, destroys internal _items array.
@@ -52,9 +54,11 @@ Fl_Tree_Item_Array::Fl_Tree_Item_Array(const Fl_Tree_Item_Array* o) {
   _size      = o->_size;
   _chunksize = o->_chunksize;
   _flags     = o->_flags;
+  _index     = 0;			// index is rebuilt lazily on first lookup
+  _stale     = 0;
   for ( int t=0; t<o->_total; t++ ) {
     if ( _flags & MANAGE_ITEM ) {
-      _items[t] = new Fl_Tree_Item(o->_items[t]);	// make new copy of item
+      _items[t] = new(o->_items[t]->tree()) Fl_Tree_Item(o->_items[t]);	// make new copy of item
       ++_total;
       _items[t]->update_prev_next(t);			// update uses _total's current value
     } else {
@@ -80,7 +84,8 @@ void Fl_Tree_Item_Array::clear() {
     }
     free((void*)_items); _items = 0;
   }
-  _total = _size = 0;
+  _total = _size = _stale = 0;
+  index_free();
 }
 
 // Internal: Enlarge the items array.
@@ -91,21 +96,36 @@ void Fl_Tree_Item_Array::clear() {
 void Fl_Tree_Item_Array::enlarge(int count) {
   int newtotal = _total + count;	// new total
   if ( newtotal >= _size ) {		// more than we have allocated?
-    if ( (newtotal/150) > _chunksize ) _chunksize *= 10;
-    // Increase size of array
-    int newsize = _size + _chunksize;
-    Fl_Tree_Item **newitems = (Fl_Tree_Item**)malloc(newsize * sizeof(Fl_Tree_Item*));
-    if ( _items ) { 
-      // Copy old array -> new, delete old
-      memmove(newitems, _items, _size * sizeof(Fl_Tree_Item*));
-      free((void*)_items); _items = 0;
-    }
-    // Adjust items/sizeitems
-    _items = newitems;
+    // Increase size of array: first by chunksize, then geometrically,
+    // so appending N items costs O(N) copying rather than O(N^2).
+    int newsize = (_size < _chunksize) ? _chunksize : _size * 2;
+    if ( newsize <= newtotal ) newsize = newtotal + 1;
+    _items = (Fl_Tree_Item**)realloc((void*)_items, newsize * sizeof(Fl_Tree_Item*));
     _size = newsize;
   }
 }
 
+// Internal: Note that items from index 'from' on were shifted in the array.
+//
+//    Their _position is updated by the next update_positions(), so that
+//    adding many items doesn't renumber the items after them every time.
+//
+void Fl_Tree_Item_Array::shifted(int from) {
+  if ( from < _stale ) _stale = from;
+}
+
+// Internal: Tell items shifted since the last call their index in the array,
+//    so that Fl_Tree_Item::find_child() finds them without a search.
+//    Only done for arrays that manage their items.
+//
+void Fl_Tree_Item_Array::update_positions() {
+  if ( _flags & MANAGE_ITEM ) {
+    for ( int t=_stale; t<_total; t++ )
+      if ( _items[t] ) _items[t]->_position = t;
+  }
+  _stale = _total;
+}
+
 /// Insert an item at index position \p pos.
 ///
 ///     Handles enlarging array if needed, total increased by 1.
@@ -120,6 +140,8 @@ void Fl_Tree_Item_Array::insert(int pos, Fl_Tree_Item *new_item) {
   } 
   _items[pos] = new_item;
   _total++;
+  index_add(new_item);
+  shifted(pos+1);			// items after it moved up
   if ( _flags & MANAGE_ITEM )
   {
     _items[pos]->update_prev_next(pos);	// adjust item's prev/next and its neighbors
@@ -140,14 +162,18 @@ void Fl_Tree_Item_Array::add(Fl_Tree_Item *val) {
 ///
 /// Old item at index position will be destroyed,
 /// and the new item will take it's place, and stitched into the linked list.
+/// \p newitem may be NULL, which leaves an empty slot at \p index.
 ///
 void Fl_Tree_Item_Array::replace(int index, Fl_Tree_Item *newitem) {
   if ( _items[index] ) {			// delete if non-zero
+    index_remove(_items[index]);
     if ( _flags & MANAGE_ITEM )
       // Destroy old item
       delete _items[index];
   }
   _items[index] = newitem;			// install new item
+  if ( !newitem ) return;
+  index_add(newitem);
   if ( _flags & MANAGE_ITEM )
   {
     // Restitch into linked list
@@ -161,6 +187,7 @@ void Fl_Tree_Item_Array::replace(int index, Fl_Tree_Item *newitem) {
 ///
 void Fl_Tree_Item_Array::remove(int index) {
   if ( _items[index] ) {			// delete if non-zero
+    index_remove(_items[index]);		// (before item and its label are destroyed)
     if ( _flags & MANAGE_ITEM )
       delete _items[index];
   }
@@ -169,6 +196,7 @@ void Fl_Tree_Item_Array::remove(int index) {
   for ( int i=index; i<_total; i++ ) {		// reshuffle the array
     _items[i] = _items[i+1];
   }
+  shifted(index);
   if ( _flags & MANAGE_ITEM )
   {
     if ( index < _total ) {			// removed item not last?
@@ -248,9 +276,11 @@ int Fl_Tree_Item_Array::deparent(int pos) {
   Fl_Tree_Item *prev = item->prev_sibling();
   Fl_Tree_Item *next = item->next_sibling();
   // Remove from parent's list of children
+  index_remove(item);
   _total -= 1;
   for ( int t=pos; t<_total; t++ )
     _items[t] = _items[t+1];            // delete, no destroy
+  shifted(pos);
   // Now an orphan: remove association with old parent and siblings
   item->update_prev_next(-1);           // become an orphan
   // Adjust bereaved siblings
@@ -272,12 +302,157 @@ int Fl_Tree_Item_Array::reparent(Fl_Tree_Item *item, Fl_Tree_Item* newparent, in
   for ( int t=_total-1; t>pos; --t )    // shuffle array to make room for new entry
     _items[t] = _items[t-1];
   _items[pos] = item;                   // insert new entry
+  index_add(item);
+  shifted(pos+1);
   // Attach to new parent and siblings
   _items[pos]->parent(newparent);       // reparent (update_prev_next() needs this)
   _items[pos]->update_prev_next(pos);   // find new siblings
   return 0;
 }
 
+// Internal: Number of items an array must hold before find_label()
+// builds the label hash index. Smaller arrays are simply scanned.
+//
+static const int INDEX_THRESHOLD = 32;
+
+// Internal: FNV-1a hash of an item's label. A NULL label hashes like ""
+// so unlabeled items still have a home slot, but never match a lookup.
+//
+static unsigned int label_hash(const char *s) {
+  unsigned int h = 2166136261U;
+  if ( s ) for ( ; *s; s++ ) { h ^= (unsigned char)*s; h *= 16777619U; }
+  return h;
+}
+
+// Internal: The label hash index.
+//
+//    One allocation holding the table and its bookkeeping, so that arrays
+//    without an index (the vast majority) only pay for a NULL pointer.
+//
+struct Fl_Tree_Item_Array::Index {
+  int size;			// #slots (power of 2)
+  int count;			// #items hashed
+  Fl_Tree_Item *slots[1];	// the table (allocated to size)
+};
+
+// Internal: (Re)build the label hash index from scratch.
+//
+//    The table is open addressed with linear probing, and kept at most
+//    half full so that probe sequences stay short.
+//
+void Fl_Tree_Item_Array::index_build() {
+  int size = 64;
+  while ( size < _total * 2 + 2 ) size *= 2;
+  if ( _index ) free((void*)_index);
+  _index = (Index*)calloc(1, sizeof(Index) + (size-1) * sizeof(Fl_Tree_Item*));
+  _index->size  = size;
+  _index->count = 0;
+  unsigned int mask = _index->size - 1;
+  for ( int t=0; t<_total; t++ ) {
+    if ( !_items[t] ) continue;		// (see replace())
+    unsigned int slot = label_hash(_items[t]->label()) & mask;
+    while ( _index->slots[slot] ) slot = (slot + 1) & mask;
+    _index->slots[slot] = _items[t];
+    ++_index->count;
+  }
+}
+
+// Internal: Free the label hash index, if any.
+//
+//    It will be rebuilt by the next find_label() on a large array.
+//
+void Fl_Tree_Item_Array::index_free() {
+  if ( _index ) { free((void*)_index); _index = 0; }
+}
+
+// Internal: Add an item that was just inserted into the array to the index.
+//
+//    Does nothing if no index has been built yet.
+//
+void Fl_Tree_Item_Array::index_add(Fl_Tree_Item *item) {
+  if ( !_index || !item ) return;
+  if ( (_index->count + 1) * 2 > _index->size ) {	// too full? rebuild larger
+    index_build();				// (picks up 'item' from _items)
+    return;
+  }
+  unsigned int mask = _index->size - 1;
+  unsigned int slot = label_hash(item->label()) & mask;
+  while ( _index->slots[slot] ) slot = (slot + 1) & mask;
+  _index->slots[slot] = item;
+  ++_index->count;
+}
+
+// Internal: Remove an item from the index.
+//
+//    Must be called while the item's label is still the one it was hashed
+//    with. Uses backward shift deletion, so no tombstones are left behind.
+//    Returns 1 if the item was removed, 0 if there's no index or the
+//    item wasn't in it.
+//
+int Fl_Tree_Item_Array::index_remove(Fl_Tree_Item *item) {
+  if ( !_index ) return 0;
+  unsigned int mask = _index->size - 1;
+  unsigned int slot = label_hash(item->label()) & mask;
+  while ( _index->slots[slot] != item ) {
+    if ( !_index->slots[slot] ) return 0;		// not indexed
+    slot = (slot + 1) & mask;
+  }
+  // Close the gap: move back any later entry whose home slot doesn't lie
+  // cyclically within (slot, next], so it stays reachable from its home.
+  unsigned int hole = slot;
+  unsigned int next = slot;
+  for (;;) {
+    next = (next + 1) & mask;
+    if ( !_index->slots[next] ) break;
+    unsigned int home = label_hash(_index->slots[next]->label()) & mask;
+    if ( ((next - home) & mask) >= ((next - hole) & mask) ) {
+      _index->slots[hole] = _index->slots[next];
+      hole = next;
+    }
+  }
+  _index->slots[hole] = 0;
+  --_index->count;
+  return 1;
+}
+
+/// Find the first item in the array whose label is \p 'name'.
+///
+///     Small arrays are searched linearly. Once the array holds more
+///     than a few dozen items, a hash index of the item labels is built
+///     on first use and kept up to date as items are added, removed or
+///     relabeled, making the lookup O(1) on average.
+///
+///     \returns the item with the lowest index whose label matches,
+///              or 0 if none (or \p 'name' is NULL).
+///
+Fl_Tree_Item *Fl_Tree_Item_Array::find_label(const char *name) const {
+  if ( !name ) return(0);
+  if ( !_index ) {
+    if ( _total <= INDEX_THRESHOLD ) {		// small? just scan
+      for ( int t=0; t<_total; t++ )
+        if ( _items[t] && _items[t]->label() && strcmp(_items[t]->label(), name) == 0 )
+          return(_items[t]);
+      return(0);
+    }
+    ((Fl_Tree_Item_Array*)this)->index_build();	// lazy: build on first use
+  }
+  unsigned int mask = _index->size - 1;
+  unsigned int slot = label_hash(name) & mask;
+  Fl_Tree_Item *found = 0;
+  for ( ; _index->slots[slot]; slot = (slot + 1) & mask ) {
+    const char *l = _index->slots[slot]->label();
+    if ( l && strcmp(l, name) == 0 ) {
+      if ( found ) {				// duplicate labels? first one wins
+        for ( int t=0; t<_total; t++ )
+          if ( _items[t] && _items[t]->label() && strcmp(_items[t]->label(), name) == 0 )
+            return(_items[t]);
+      }
+      found = _index->slots[slot];
+    }
+  }
+  return(found);
+}
+
 //
 // End of "$Id$".
 //
@@ -23,6 +23,7 @@
 #include <FL/fl_draw.H>
 #include <stdlib.h>
 #include "flstring.h"
+#include "Fl_Widget_Cache.H"
 
 
 ////////////////////////////////////////////////////////////////
@@ -120,6 +121,7 @@ Fl_Widget::Fl_Widget(int X, int Y, int W, int H, const char* L) {
   label_.color	 = FL_FOREGROUND_COLOR;
   label_.align_	 = FL_ALIGN_CENTER;
   tooltip_       = 0;
+  cache_         = 0;
   callback_	 = default_callback;
   user_data_ 	 = 0;
   type_		 = 0;
@@ -170,6 +172,7 @@ Fl_Widget::~Fl_Widget() {
   Fl::clear_widget_pointer(this);
   if (flags() & COPIED_LABEL) free((void *)(label_.value));
   if (flags() & COPIED_TOOLTIP) free((void *)(tooltip_));
+  delete cache_;
   // remove from parent group
   if (parent_) parent_->remove(this);
 #ifdef DEBUG_DELETE
@@ -274,6 +277,16 @@ int Fl_Widget::contains(const Fl_Widget *o) const {
   return 0;
 }
 
+// The offscreen copy is made by Fl_Group::draw_child() and update_child()
+void Fl_Widget::cached(int c) {
+  if (c) set_flag(CACHED);
+  else {
+    clear_flag(CACHED);
+    delete cache_;
+    cache_ = 0;
+  }
+}
+
 
 void Fl_Widget::label(const char *a) {
   if (flags() & COPIED_LABEL) {
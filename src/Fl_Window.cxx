@@ -467,6 +467,12 @@ int Fl_Window::decorated_h() const
 }
 
 
+unsigned long Fl_Window::repainted_pixels() const
+{
+  return pWindowDriver->repainted_pixels();
+}
+
+
 void Fl_Window::flush()
 {
   if (!shown()) return;
@@ -44,6 +44,8 @@ pWindow(win)
   shape_data_ = NULL;
   wait_for_expose_value = 0;
   other_xid = 0;
+  damage_rects_ = -1;
+  repainted_pixels_ = 0;
 }
 
 
@@ -214,6 +216,123 @@ void Fl_Window_Driver::flush()
   pWindow->flush();
 }
 
+
+/** Makes X,Y,W,H the only damage rectangle of the window */
+void Fl_Window_Driver::reset_damage(int X, int Y, int W, int H)
+{
+  damage_rects_ = 0;
+  add_damage(X, Y, W, H);
+}
+
+
+// Returns the area of the rectangle covering both a and b that neither covers,
+// and sets covered to the area they cover
+static long merge_waste(const Fl_Window_Driver::Damage_Rect &a,
+                        const Fl_Window_Driver::Damage_Rect &b, long &covered)
+{
+  covered = long(a.r - a.x) * (a.b - a.y) + long(b.r - b.x) * (b.b - b.y);
+  int ox = (a.r < b.r ? a.r : b.r) - (a.x > b.x ? a.x : b.x);
+  int oy = (a.b < b.b ? a.b : b.b) - (a.y > b.y ? a.y : b.y);
+  if (ox > 0 && oy > 0) covered -= long(ox) * oy;
+  int x = a.x < b.x ? a.x : b.x, r = a.r > b.r ? a.r : b.r;
+  int y = a.y < b.y ? a.y : b.y, bottom = a.b > b.b ? a.b : b.b;
+  return long(r - x) * (bottom - y) - covered;
+}
+
+
+/**
+ Adds X,Y,W,H to the damage rectangles of the window, unless the whole
+ window is damaged.
+
+ The new rectangle is merged with the rectangle that costs the least to
+ merge it with, when the rectangle covering both has an area not covered
+ by either of them of at most a quarter of the area they cover, or when
+ there are already max_damage_rects rectangles. The merged rectangle is
+ then added again, because it can now merge with others.
+ */
+void Fl_Window_Driver::add_damage(int X, int Y, int W, int H)
+{
+  if (damage_rects_ < 0 || W <= 0 || H <= 0) return;
+  Damage_Rect n;
+  n.x = X; n.y = Y; n.r = X + W; n.b = Y + H;
+  for (;;) {
+    int best = -1;
+    long best_waste = 0, best_covered = 0;
+    for (int k = 0; k < damage_rects_; k++) {
+      const Damage_Rect &e = damage_rect_[k];
+      if (e.x <= n.x && e.y <= n.y && e.r >= n.r && e.b >= n.b) return; // already damaged
+      long covered, waste = merge_waste(e, n, covered);
+      if (best < 0 || waste < best_waste) {
+        best = k;
+        best_waste = waste;
+        best_covered = covered;
+      }
+    }
+    if (best < 0 || (damage_rects_ < max_damage_rects && 4 * best_waste > best_covered)) {
+      damage_rect_[damage_rects_++] = n;
+      return;
+    }
+    const Damage_Rect &e = damage_rect_[best];
+    if (e.x < n.x) n.x = e.x;
+    if (e.y < n.y) n.y = e.y;
+    if (e.r > n.r) n.r = e.r;
+    if (e.b > n.b) n.b = e.b;
+    damage_rect_[best] = damage_rect_[--damage_rects_];
+  }
+}
+
+
+// Returns the area covered by the damage rectangles. The rectangles can
+// overlap, so this adds the areas of the cells of the grid made by their
+// edges which are inside one of them.
+unsigned long Fl_Window_Driver::damage_area() const
+{
+  if (damage_rects_ < 0) return (unsigned long)w() * h();
+  int xs[2 * max_damage_rects], ys[2 * max_damage_rects], nx = 0, ny = 0;
+  int i, j, k;
+  for (k = 0; k < damage_rects_; k++) {
+    xs[nx++] = damage_rect_[k].x; xs[nx++] = damage_rect_[k].r;
+    ys[ny++] = damage_rect_[k].y; ys[ny++] = damage_rect_[k].b;
+  }
+  for (i = 1; i < nx; i++) { // insertion sort of the few edges
+    int x = xs[i], y = ys[i];
+    for (j = i; j > 0 && xs[j - 1] > x; j--) xs[j] = xs[j - 1];
+    xs[j] = x;
+    for (j = i; j > 0 && ys[j - 1] > y; j--) ys[j] = ys[j - 1];
+    ys[j] = y;
+  }
+  unsigned long area = 0;
+  for (i = 0; i + 1 < nx; i++) {
+    if (xs[i] == xs[i + 1]) continue;
+    for (j = 0; j + 1 < ny; j++) {
+      if (ys[j] == ys[j + 1]) continue;
+      for (k = 0; k < damage_rects_; k++) {
+        const Damage_Rect &e = damage_rect_[k];
+        if (e.x <= xs[i] && e.r >= xs[i + 1] && e.y <= ys[j] && e.b >= ys[j + 1]) {
+          area += (unsigned long)(xs[i + 1] - xs[i]) * (ys[j + 1] - ys[j]);
+          break;
+        }
+      }
+    }
+  }
+  return area;
+}
+
+
+/**
+ Flushes the window for Fl::flush(), and records the area it repaints.
+ Drawing is clipped to the damage region of the window, which also makes
+ Fl_Group skip the children outside it (see fl_not_clipped()). Some
+ platforms have no regions, and then the whole window is repainted.
+ */
+void Fl_Window_Driver::flush_damage()
+{
+  if (!Fl_X::i(pWindow)->region) damage_all();
+  repainted_pixels_ = damage_area();
+  flush();
+  damage_all();
+}
+
 int Fl_Window_Driver::set_cursor(Fl_Cursor) {
   return 0;
 }
@@ -0,0 +1,91 @@
+//
+// "$Id$"
+//
+// Copy-to-clipboard code of the headless platform
+// for the Fast Light Tool Kit (FLTK).
+//
+// Copyright 2018 by Bill Spitzak and others.
+//
+// This library is free software. Distribution and use rights are outlined in
+// the file "COPYING" which should have been included with this file.  If this
+// file is missing or damaged, see the license at:
+//
+//     http://www.fltk.org/COPYING.php
+//
+// Please report all bugs and problems on the following page:
+//
+//     http://www.fltk.org/str.php
+//
+
+#include "../../config_lib.h"
+#include <FL/Fl_Copy_Surface.H>
+#include <FL/Fl.H>
+#include <FL/Fl_RGB_Image.H>
+#include "../Raster/Fl_Raster_Graphics_Driver.H"
+#include "Fl_Headless_System_Driver.H"
+#include <string.h>
+
+/*
+ Draws with the raster graphics driver on white pixels, and puts them in
+ the clipboard of Fl_Headless_System_Driver when deleted.
+ */
+class Fl_Headless_Copy_Surface_Driver : public Fl_Copy_Surface_Driver {
+  friend class Fl_Copy_Surface_Driver;
+protected:
+  unsigned *pixels;
+  Fl_Headless_Copy_Surface_Driver(int w, int h);
+  ~Fl_Headless_Copy_Surface_Driver();
+  void set_current();
+  void translate(int x, int y);
+  void untranslate();
+};
+
+
+Fl_Copy_Surface_Driver *Fl_Copy_Surface_Driver::newCopySurfaceDriver(int w, int h)
+{
+  return new Fl_Headless_Copy_Surface_Driver(w, h);
+}
+
+
+Fl_Headless_Copy_Surface_Driver::Fl_Headless_Copy_Surface_Driver(int w, int h) : Fl_Copy_Surface_Driver(w, h) {
+  pixels = new unsigned[w * h];
+  memset(pixels, 0xff, w * h * sizeof(unsigned));
+  Fl_Raster_Graphics_Driver *d = new Fl_Raster_Graphics_Driver();
+  d->buffer(pixels, w, h);
+  driver(d);
+}
+
+
+Fl_Headless_Copy_Surface_Driver::~Fl_Headless_Copy_Surface_Driver() {
+  uchar *data = new uchar[width * height * 3], *q = data;
+  const unsigned *p = pixels, *end = p + width * height;
+  for (; p < end; p++, q += 3) {
+    q[0] = uchar(*p >> 16);
+    q[1] = uchar(*p >> 8);
+    q[2] = uchar(*p);
+  }
+  Fl_RGB_Image *image = new Fl_RGB_Image(data, width, height, 3);
+  image->alloc_array = 1;
+  ((Fl_Headless_System_Driver*)Fl::system_driver())->copy_image(image);
+  delete driver();
+  delete[] pixels;
+}
+
+
+void Fl_Headless_Copy_Surface_Driver::set_current() {
+  Fl_Surface_Device::set_current();
+}
+
+
+void Fl_Headless_Copy_Surface_Driver::translate(int x, int y) {
+  ((Fl_Raster_Graphics_Driver*)driver())->translate_all(x, y);
+}
+
+
+void Fl_Headless_Copy_Surface_Driver::untranslate() {
+  ((Fl_Raster_Graphics_Driver*)driver())->untranslate_all();
+}
+
+//
+// End of "$Id$".
+//
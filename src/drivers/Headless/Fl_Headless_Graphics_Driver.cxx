@@ -0,0 +1,103 @@
+//
+// "$Id$"
+//
+// Regions of the headless graphics driver
+// for the Fast Light Tool Kit (FLTK).
+//
+// Copyright 2018 by Bill Spitzak and others.
+//
+// This library is free software. Distribution and use rights are outlined in
+// the file "COPYING" which should have been included with this file.  If this
+// file is missing or damaged, see the license at:
+//
+//     http://www.fltk.org/COPYING.php
+//
+// Please report all bugs and problems on the following page:
+//
+//     http://www.fltk.org/str.php
+//
+
+#include "../../config_lib.h"
+#include "Fl_Headless_Graphics_Driver.H"
+#include <stdlib.h>
+
+
+// Fl_Region is a pointer to a struct _XRegion on this platform, as on X11.
+// Here it is a list of rectangles that do not overlap; r and b are excluded.
+struct _XRegion {
+  struct Rect { int x, y, r, b; };
+  int count, size;
+  Rect *rects;
+};
+
+
+Fl_Region Fl_Headless_Graphics_Driver::XRectangleRegion(int x, int y, int w, int h) {
+  Fl_Region r = (Fl_Region)malloc(sizeof(_XRegion));
+  r->count = r->size = 0;
+  r->rects = 0;
+  add_rectangle_to_region(r, x, y, w, h);
+  return r;
+}
+
+
+// Adds the part of rectangle x,y,r,b that is outside the rectangles of
+// region reg from the i-th one on. The rectangles of a region never overlap,
+// so that the pixels they clip are drawn once, which matters when blending.
+static void add_outside(Fl_Region reg, int i, int x, int y, int r, int b) {
+  for (; i < reg->count; i++) {
+    const _XRegion::Rect c = reg->rects[i]; // a copy, adding can move the rectangles
+    if (x >= c.r || y >= c.b || r <= c.x || b <= c.y) continue;
+    if (y < c.y) add_outside(reg, i + 1, x, y, r, c.y);                    // above c
+    if (b > c.b) add_outside(reg, i + 1, x, c.b, r, b);                    // below c
+    int top = y > c.y ? y : c.y, bottom = b < c.b ? b : c.b;
+    if (x < c.x) add_outside(reg, i + 1, x, top, c.x, bottom);             // left of c
+    if (r > c.r) add_outside(reg, i + 1, c.r, top, r, bottom);             // right of c
+    return;
+  }
+  if (reg->count >= reg->size) {
+    reg->size = 2 * reg->size + 4;
+    reg->rects = (_XRegion::Rect*)realloc(reg->rects, reg->size * sizeof(_XRegion::Rect));
+  }
+  _XRegion::Rect &n = reg->rects[reg->count++];
+  n.x = x; n.y = y; n.r = r; n.b = b;
+}
+
+
+void Fl_Headless_Graphics_Driver::add_rectangle_to_region(Fl_Region r, int x, int y, int w, int h) {
+  if (w > 0 && h > 0) add_outside(r, 0, x, y, x + w, y + h);
+}
+
+
+void Fl_Headless_Graphics_Driver::XDestroyRegion(Fl_Region r) {
+  if (!r) return;
+  free(r->rects);
+  free(r);
+}
+
+
+/** Replaces the top of the clip stack by region \p r, or by the whole buffer if \p r is NULL */
+void Fl_Headless_Graphics_Driver::clip_region(Fl_Region r) {
+  set_no_clip();
+  if (r) {
+    int start = clip_start_[rstackptr], n = 0;
+    reserve_clip(start + r->count);
+    for (int i = 0; i < r->count; i++) {
+      Clip_Rect &d = clip_[start + n];
+      d.x = r->rects[i].x + offset_x_;
+      d.y = r->rects[i].y + offset_y_;
+      d.r = r->rects[i].r + offset_x_;
+      d.b = r->rects[i].b + offset_y_;
+      if (d.x < 0) d.x = 0;
+      if (d.y < 0) d.y = 0;
+      if (d.r > width_) d.r = width_;
+      if (d.b > height_) d.b = height_;
+      if (d.x < d.r && d.y < d.b) n++;
+    }
+    clip_count_[rstackptr] = n;
+  }
+  Fl_Graphics_Driver::clip_region(r);
+}
+
+//
+// End of "$Id$".
+//
@@ -0,0 +1,73 @@
+//
+// "$Id$"
+//
+// Fonts, graphics driver and image surface of the headless platform
+// for the Fast Light Tool Kit (FLTK).
+//
+// Copyright 2018 by Bill Spitzak and others.
+//
+// This library is free software. Distribution and use rights are outlined in
+// the file "COPYING" which should have been included with this file.  If this
+// file is missing or damaged, see the license at:
+//
+//     http://www.fltk.org/COPYING.php
+//
+// Please report all bugs and problems on the following page:
+//
+//     http://www.fltk.org/str.php
+//
+
+#include "../../config_lib.h"
+#include "Fl_Headless_Graphics_Driver.H"
+#include "../Raster/Fl_Raster_Image_Surface_Driver.H"
+#include <FL/fl_draw.H>
+
+
+// The predefined fonts. Text is drawn with the vector font of the Pico
+// graphics driver, which only uses the names of these faces.
+static Fl_Fontdesc built_in_table[] = {
+  {" sans"},
+  {"Bsans"},
+  {"Isans"},
+  {"Psans"},
+  {" mono"},
+  {"Bmono"},
+  {"Imono"},
+  {"Pmono"},
+  {" serif"},
+  {"Bserif"},
+  {"Iserif"},
+  {"Pserif"},
+  {" symbol"},
+  {" screen"},
+  {"Bscreen"},
+  {" zapf dingbats"},
+};
+
+Fl_Fontdesc* fl_fonts = built_in_table;
+
+
+/*
+ The raster graphics driver, with regions, is the main display driver:
+ windows are buffers of pixels in memory.
+ */
+Fl_Graphics_Driver *Fl_Graphics_Driver::newMainGraphicsDriver()
+{
+  return new Fl_Headless_Graphics_Driver();
+}
+
+
+void fl_rectf(int x, int y, int w, int h, uchar r, uchar g, uchar b) {
+  fl_color(r,g,b);
+  fl_rectf(x,y,w,h);
+}
+
+
+Fl_Image_Surface_Driver *Fl_Image_Surface_Driver::newImageSurfaceDriver(int w, int h, int high_res, Fl_Offscreen off)
+{
+  return new Fl_Raster_Image_Surface_Driver(w, h);
+}
+
+//
+// End of "$Id$".
+//
@@ -0,0 +1,531 @@
+//
+// "$Id$"
+//
+// Definition of the headless Screen interface
+// for the Fast Light Tool Kit (FLTK).
+//
+// Copyright 2018 by Bill Spitzak and others.
+//
+// This library is free software. Distribution and use rights are outlined in
+// the file "COPYING" which should have been included with this file.  If this
+// file is missing or damaged, see the license at:
+//
+//     http://www.fltk.org/COPYING.php
+//
+// Please report all bugs and problems on the following page:
+//
+//     http://www.fltk.org/str.php
+//
+
+
+#include "../../config_lib.h"
+#include "Fl_Headless_Screen_Driver.H"
+#include "Fl_Headless_System_Driver.H"
+#include "../Raster/Fl_Raster_Graphics_Driver.H"
+#include "../Raster/Fl_Raster_Image_Surface_Driver.H"
+
+#include <FL/Fl.H>
+#include <FL/Fl_Window.H>
+#include <FL/Fl_RGB_Image.H>
+#include <FL/fl_utf8.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#define FOREVER 1e20 // as in Fl.cxx
+
+extern Fl_Window *fl_xfocus;    // in Fl.cxx
+extern Fl_Window *fl_xmousewin; // in Fl.cxx
+extern void fl_fix_focus();     // in Fl.cxx
+
+Fl_Headless_Stats Fl_Headless_Screen_Driver::stats;
+
+
+Fl_Screen_Driver* Fl_Screen_Driver::newScreenDriver()
+{
+  return new Fl_Headless_Screen_Driver();
+}
+
+
+Fl_Headless_Screen_Driver::Fl_Headless_Screen_Driver()
+{
+  first_timeout = free_timeout = NULL;
+  clock_ = 0;
+  timeout_time_ = -1;
+  events_ = NULL;
+  first_event_ = nevents_ = events_size_ = 0;
+  mouse_x_ = mouse_y_ = 0;
+  push_x_ = push_y_ = 0;
+  push_time_ = 0;
+  if (fl_getenv("FLTK_HEADLESS_STATS")) atexit(print_stats);
+}
+
+
+Fl_Headless_Screen_Driver::~Fl_Headless_Screen_Driver()
+{
+  while (first_timeout) {
+    Timeout *t = first_timeout;
+    first_timeout = t->next;
+    delete t;
+  }
+  while (free_timeout) {
+    Timeout *t = free_timeout;
+    free_timeout = t->next;
+    delete t;
+  }
+  free(events_);
+}
+
+
+// Real time in seconds, used to measure the work done
+double Fl_Headless_Screen_Driver::now()
+{
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+
+void Fl_Headless_Screen_Driver::print_stats()
+{
+  Fl_Headless_Stats &s = stats;
+  fprintf(stderr, "FLTK headless: %lu events in %.3f s, %lu frames in %.3f s"
+          " (%.3f ms and %lu pixels per frame), %lu timeouts, %.3f s simulated\n",
+          s.events, s.event_time, s.frames, s.draw_time,
+          s.frames ? s.draw_time * 1000 / s.frames : 0.0,
+          s.frames ? s.pixels / s.frames : 0, s.timeouts, fl_headless_time());
+}
+
+
+/**
+ Adds an event to the queue. It is handled by the next call to wait().
+ */
+void Fl_Headless_Screen_Driver::queue(int type, Fl_Window *win, int x, int y, int key,
+                                      const char *text, int dx, int dy)
+{
+  if (!win || !win->shown()) return;
+  if (first_event_ == nevents_) first_event_ = nevents_ = 0;
+  if (nevents_ >= events_size_) {
+    events_size_ = events_size_ ? 2 * events_size_ : 64;
+    events_ = (Event*)realloc(events_, events_size_ * sizeof(Event));
+  }
+  Event &e = events_[nevents_++];
+  e.type = type;
+  e.window = win;
+  e.x = x; e.y = y;
+  e.dx = dx; e.dy = dy;
+  e.key = key;
+  e.text[0] = 0;
+  if (text) {
+    strncpy(e.text, text, sizeof(e.text) - 1);
+    e.text[sizeof(e.text) - 1] = 0;
+  }
+}
+
+
+/**
+ Drops the pending events of a window that is hidden.
+ */
+void Fl_Headless_Screen_Driver::forget(Fl_Window *win)
+{
+  for (int i = first_event_; i < nevents_; i++) {
+    if (events_[i].window == win) events_[i].window = NULL;
+  }
+}
+
+
+static int modifier(int key)
+{
+  switch (key) {
+    case FL_Shift_L: case FL_Shift_R: return FL_SHIFT;
+    case FL_Control_L: case FL_Control_R: return FL_CTRL;
+    case FL_Alt_L: case FL_Alt_R: return FL_ALT;
+    case FL_Meta_L: case FL_Meta_R: return FL_META;
+  }
+  return 0;
+}
+
+
+// Sets the event variables and sends the event to the window, as fl_handle()
+// of the X11 platform does with an X event
+void Fl_Headless_Screen_Driver::handle_event(Event &e)
+{
+  Fl_Window *window = e.window;
+  if (!window) return; // hidden since the event was queued
+  int event = e.type;
+  static char buffer[8];
+  if (event == FL_KEYDOWN || event == FL_KEYUP) {
+    Fl_Headless_System_Driver *system = (Fl_Headless_System_Driver*)Fl::system_driver();
+    system->key(e.key, event == FL_KEYDOWN);
+    Fl::e_keysym = Fl::e_original_keysym = e.key;
+    strcpy(buffer, event == FL_KEYDOWN ? e.text : "");
+    Fl::e_text = buffer;
+    Fl::e_length = (int)strlen(buffer);
+  } else {
+    Fl::e_x = e.x;
+    Fl::e_y = e.y;
+    Fl::e_x_root = mouse_x_ = e.x + window->x_root();
+    Fl::e_y_root = mouse_y_ = e.y + window->y_root();
+    // turn off is_click if enough time or mouse movement has passed:
+    if (abs(Fl::e_x_root - push_x_) + abs(Fl::e_y_root - push_y_) > 3 ||
+        clock_ >= push_time_ + 1) {
+      Fl::e_is_click = 0;
+    }
+    switch (event) {
+      case FL_MOVE:
+        fl_xmousewin = window;
+        if (Fl::e_state & FL_BUTTONS) event = FL_DRAG;
+        break;
+      case FL_MOUSEWHEEL:
+        Fl::e_dx = e.dx;
+        Fl::e_dy = e.dy;
+        break;
+      case FL_PUSH: {
+        Fl::e_keysym = FL_Button + e.key;
+        Fl::e_state |= (FL_BUTTON1 << (e.key - 1));
+        if (Fl::e_is_click == Fl::e_keysym) {
+          Fl::e_clicks++;
+        } else {
+          Fl::e_clicks = 0;
+          Fl::e_is_click = Fl::e_keysym;
+        }
+        push_x_ = Fl::e_x_root;
+        push_y_ = Fl::e_y_root;
+        push_time_ = clock_;
+        // a click gives the focus to the window, as a window manager does:
+        Fl_Window *top = window->top_window();
+        if (fl_xfocus != top) {
+          fl_xfocus = top;
+          fl_fix_focus();
+        }
+        break;
+      }
+      case FL_RELEASE:
+        Fl::e_keysym = FL_Button + e.key;
+        Fl::e_state &= ~(FL_BUTTON1 << (e.key - 1));
+        break;
+    }
+  }
+  double start = now();
+  Fl::handle(event, window);
+  stats.event_time += now() - start;
+  stats.events++;
+  // the state of the modifiers changes after their own events:
+  if (event == FL_KEYDOWN) {
+    Fl::e_state |= modifier(e.key);
+    if (e.key == FL_Caps_Lock) Fl::e_state ^= FL_CAPS_LOCK;
+  } else if (event == FL_KEYUP) {
+    Fl::e_state &= ~modifier(e.key);
+  }
+}
+
+
+// Calls the timeouts that are due on the simulated clock
+void Fl_Headless_Screen_Driver::call_timeouts()
+{
+  double previous_time = timeout_time_;
+  Timeout *t;
+  while ((t = first_timeout) && t->time <= clock_) {
+    // We must remove timeout from list before doing the callback:
+    void (*cb)(void*) = t->cb;
+    void *argp = t->arg;
+    timeout_time_ = t->time;
+    first_timeout = t->next;
+    t->next = free_timeout;
+    free_timeout = t;
+    // Now it is safe for the callback to do add_timeout:
+    stats.timeouts++;
+    cb(argp);
+  }
+  timeout_time_ = previous_time;
+}
+
+
+/**
+ Handles the pending events, or else advances the simulated clock.
+
+ The clock does not run while the program works: it only advances here,
+ when there is nothing to do, by \p time_to_wait or to the next timeout,
+ whichever comes first. This makes timers deterministic, and programs
+ with animations run as fast as they can draw.
+ */
+double Fl_Headless_Screen_Driver::wait(double time_to_wait)
+{
+  static char in_idle;
+  Fl_Headless_System_Driver *system = (Fl_Headless_System_Driver*)Fl::system_driver();
+
+  call_timeouts();
+  Fl::run_checks();
+  if (Fl::idle) {
+    if (!in_idle) {
+      in_idle = 1;
+      Fl::idle();
+      in_idle = 0;
+    }
+    // the idle function may turn off idle, we can then wait:
+    if (Fl::idle) time_to_wait = 0.0;
+  }
+  int ret = system->poll_or_select_with_delay(0.0);
+  if (ret < 0) ret = 0;
+  if (first_event_ < nevents_) {
+    // handling an event may queue more events, which are handled too:
+    while (first_event_ < nevents_) {
+      Event e = events_[first_event_++];
+      handle_event(e);
+    }
+    ret = 1;
+  }
+  // do flush second so that the results of events are visible:
+  Fl::flush();
+  if (ret || time_to_wait <= 0.0) return ret;
+
+  if (first_timeout && first_timeout->time - clock_ <= time_to_wait) {
+    clock_ = first_timeout->time;
+    call_timeouts();
+    Fl::flush();
+    return 1;
+  }
+  if (time_to_wait < FOREVER) {
+    clock_ += time_to_wait;
+    return 0;
+  }
+  if (system->has_fds()) return system->poll_or_select_with_delay(FOREVER);
+  // Nothing can happen anymore, as if the user closed all windows. A window
+  // that refuses to be hidden is left alone, so that this does not loop.
+  Fl_Window *win = Fl::first_window();
+  while (win) {
+    win->hide();
+    Fl_Window *next = Fl::first_window();
+    if (next == win) break;
+    win = next;
+  }
+  return 0;
+}
+
+
+int Fl_Headless_Screen_Driver::ready()
+{
+  if (first_event_ < nevents_) return 1;
+  if (first_timeout && first_timeout->time <= clock_) return 1;
+  return ((Fl_Headless_System_Driver*)Fl::system_driver())->poll_or_select() > 0;
+}
+
+
+void Fl_Headless_Screen_Driver::grab(Fl_Window* win)
+{
+  if (win) {
+    Fl::grab_ = win;	// FIXME: Fl::grab_ "should be private", but we need
+			// a way to *set* the variable from the driver!
+  } else {
+    if (Fl::grab()) {
+      Fl::grab_ = 0;
+      fl_fix_focus();
+    }
+  }
+}
+
+
+void Fl_Headless_Screen_Driver::get_system_colors()
+{
+  // there is no desktop to take colors from, use the X11 defaults
+  if (!bg2_set) Fl::background2(0xff, 0xff, 0xff);
+  if (!fg_set) Fl::foreground(0, 0, 0);
+  if (!bg_set) Fl::background(0xc0, 0xc0, 0xc0);
+}
+
+
+void Fl_Headless_Screen_Driver::add_timeout(double time, Fl_Timeout_Handler cb, void *argp)
+{
+  Timeout *t = free_timeout;
+  if (t) free_timeout = t->next;
+  else t = new Timeout;
+  t->time = clock_ + time;
+  t->cb = cb;
+  t->arg = argp;
+  // insert-sort the new timeout, after those due at the same time:
+  Timeout **p = &first_timeout;
+  while (*p && (*p)->time <= t->time) p = &((*p)->next);
+  t->next = *p;
+  *p = t;
+}
+
+
+/**
+ Adds a timeout \p time seconds after the time the timeout being called was
+ due, so that repeated timeouts do not drift.
+ */
+void Fl_Headless_Screen_Driver::repeat_timeout(double time, Fl_Timeout_Handler cb, void *argp)
+{
+  if (timeout_time_ >= 0) time += timeout_time_ - clock_;
+  add_timeout(time, cb, argp);
+}
+
+
+int Fl_Headless_Screen_Driver::has_timeout(Fl_Timeout_Handler cb, void *argp)
+{
+  for (Timeout *t = first_timeout; t; t = t->next)
+    if (t->cb == cb && t->arg == argp) return 1;
+  return 0;
+}
+
+
+void Fl_Headless_Screen_Driver::remove_timeout(Fl_Timeout_Handler cb, void *argp)
+{
+  for (Timeout **p = &first_timeout; *p;) {
+    Timeout *t = *p;
+    if (t->cb == cb && (t->arg == argp || !argp)) {
+      *p = t->next;
+      t->next = free_timeout;
+      free_timeout = t;
+    } else {
+      p = &(t->next);
+    }
+  }
+}
+
+
+int Fl_Headless_Screen_Driver::compose(int& del) {
+  int condition;
+  unsigned char ascii = (unsigned char)Fl::e_text[0];
+  condition = (Fl::e_state & (FL_ALT | FL_META | FL_CTRL)) && !(ascii & 128) ;
+  if (condition) { del = 0; return 0;} // this stuff is to be treated as a function key
+  del = Fl::compose_state;
+  Fl::compose_state = 0;
+  // Only insert non-control characters:
+  if ( (!Fl::compose_state) && ! (ascii & ~31 && ascii!=127)) { return 0; }
+  return 1;
+}
+
+
+// there is no input method to show the status of
+void fl_set_status(int x, int y, int w, int h)
+{
+}
+
+
+/**
+ Reads a rectangle of the pixels of the current window or image surface.
+ */
+Fl_RGB_Image *Fl_Headless_Screen_Driver::read_win_rectangle(int X, int Y, int w, int h)
+{
+  if (w <= 0 || h <= 0 || fl_graphics_driver->has_feature(Fl_Graphics_Driver::PRINTER))
+    return NULL;
+  Fl_Raster_Graphics_Driver *d = (Fl_Raster_Graphics_Driver*)fl_graphics_driver;
+  const unsigned *pixels = d->buffer();
+  if (!pixels) return NULL;
+  uchar *data = new uchar[w * h * 3];
+  memset(data, 0, w * h * 3);
+  for (int j = 0; j < h; j++) {
+    if (Y + j < 0 || Y + j >= d->buffer_height()) continue;
+    const unsigned *p = pixels + (Y + j) * d->buffer_stride();
+    uchar *q = data + j * w * 3;
+    for (int i = 0; i < w; i++, q += 3) {
+      if (X + i < 0 || X + i >= d->buffer_width()) continue;
+      unsigned c = p[X + i];
+      q[0] = uchar(c >> 16);
+      q[1] = uchar(c >> 8);
+      q[2] = uchar(c);
+    }
+  }
+  Fl_RGB_Image *image = new Fl_RGB_Image(data, w, h, 3);
+  image->alloc_array = 1;
+  return image;
+}
+
+
+int Fl_Headless_Screen_Driver::get_mouse(int &x, int &y)
+{
+  x = mouse_x_;
+  y = mouse_y_;
+  return 0;
+}
+
+
+void Fl_Headless_Screen_Driver::offscreen_size(Fl_Offscreen off, int &width, int &height)
+{
+  Fl_Raster_Image_Surface_Driver *surf = Fl_Raster_Image_Surface_Driver::find(off);
+  if (!surf) return;
+  Fl_Raster_Graphics_Driver *d = (Fl_Raster_Graphics_Driver*)surf->driver();
+  width = d->buffer_width();
+  height = d->buffer_height();
+}
+
+
+static Fl_Headless_Screen_Driver *headless_screen()
+{
+  return (Fl_Headless_Screen_Driver*)Fl::screen_driver();
+}
+
+
+void fl_headless_move(Fl_Window *win, int x, int y)
+{
+  headless_screen()->queue(FL_MOVE, win, x, y, 0);
+}
+
+
+void fl_headless_button(Fl_Window *win, int x, int y, int button, int pressed)
+{
+  headless_screen()->queue(pressed ? FL_PUSH : FL_RELEASE, win, x, y, button);
+}
+
+
+void fl_headless_wheel(Fl_Window *win, int x, int y, int dx, int dy)
+{
+  headless_screen()->queue(FL_MOUSEWHEEL, win, x, y, 0, NULL, dx, dy);
+}
+
+
+void fl_headless_key(Fl_Window *win, int key, int pressed, const char *text)
+{
+  headless_screen()->queue(pressed ? FL_KEYDOWN : FL_KEYUP, win, 0, 0, key, text);
+}
+
+
+/**
+ Queues the key presses and releases that type the UTF-8 \p text.
+ */
+void fl_headless_type(Fl_Window *win, const char *text)
+{
+  const char *end = text + strlen(text);
+  while (text < end) {
+    int len;
+    unsigned c = fl_utf8decode(text, end, &len);
+    char buf[8];
+    memcpy(buf, text, len);
+    buf[len] = 0;
+    text += len;
+    int key = c;
+    switch (c) {
+      case '\n': case '\r': key = FL_Enter; strcpy(buf, "\r"); break;
+      case '\t': key = FL_Tab; break;
+      case '\b': key = FL_BackSpace; break;
+      case 27: key = FL_Escape; break;
+      default: if (c >= 'A' && c <= 'Z') key = c - 'A' + 'a'; break;
+    }
+    fl_headless_key(win, key, 1, buf);
+    fl_headless_key(win, key, 0);
+  }
+}
+
+
+double fl_headless_time()
+{
+  return headless_screen()->time();
+}
+
+
+void fl_headless_stats(Fl_Headless_Stats *s)
+{
+  *s = Fl_Headless_Screen_Driver::stats;
+}
+
+
+void fl_headless_reset_stats()
+{
+  memset(&Fl_Headless_Screen_Driver::stats, 0, sizeof(Fl_Headless_Stats));
+}
+
+//
+// End of "$Id$".
+//
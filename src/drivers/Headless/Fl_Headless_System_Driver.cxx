@@ -0,0 +1,151 @@
+//
+// "$Id$"
+//
+// Definition of the headless system driver
+// for the Fast Light Tool Kit (FLTK).
+//
+// Copyright 2018 by Bill Spitzak and others.
+//
+// This library is free software. Distribution and use rights are outlined in
+// the file "COPYING" which should have been included with this file.  If this
+// file is missing or damaged, see the license at:
+//
+//     http://www.fltk.org/COPYING.php
+//
+// Please report all bugs and problems on the following page:
+//
+//     http://www.fltk.org/str.php
+//
+
+
+#include "../../config_lib.h"
+#include "Fl_Headless_System_Driver.H"
+#include <FL/Fl.H>
+#include <FL/Fl_Widget.H>
+#include <FL/Fl_RGB_Image.H>
+#include <stdlib.h>
+#include <string.h>
+
+
+Fl_System_Driver *Fl_System_Driver::newSystemDriver()
+{
+  return new Fl_Headless_System_Driver();
+}
+
+
+Fl_Headless_System_Driver::Fl_Headless_System_Driver() : Fl_Posix_System_Driver() {
+  nkeys_ = 0;
+  selection_[0] = selection_[1] = NULL;
+  selection_length_[0] = selection_length_[1] = 0;
+  clipboard_image_ = NULL;
+}
+
+
+Fl_Headless_System_Driver::~Fl_Headless_System_Driver() {
+  delete[] selection_[0];
+  delete[] selection_[1];
+  delete clipboard_image_;
+}
+
+
+/** Records that key \p k is pressed or released, for event_key() and get_key() */
+void Fl_Headless_System_Driver::key(int k, int pressed) {
+  int i;
+  for (i = 0; i < nkeys_; i++) if (keys_[i] == k) break;
+  if (pressed) {
+    if (i == nkeys_ && nkeys_ < KEYS) keys_[nkeys_++] = k;
+  } else if (i < nkeys_) {
+    keys_[i] = keys_[--nkeys_];
+  }
+}
+
+
+int Fl_Headless_System_Driver::event_key(int k) {
+  if (k > FL_Button && k <= FL_Button+8)
+    return Fl::event_state(8<<(k-FL_Button));
+  for (int i = 0; i < nkeys_; i++) if (keys_[i] == k) return 1;
+  return 0;
+}
+
+
+int Fl_Headless_System_Driver::get_key(int k) {
+  return event_key(k);
+}
+
+
+const char *Fl_Headless_System_Driver::filename_name(const char *name) {
+  const char *p,*q;
+  if (!name) return (0);
+  for (p=q=name; *p;) if (*p++ == '/') q = p;
+  return q;
+}
+
+
+////////////////////////////////////////////////////////////////
+// The clipboard only exists in the program, there is no other
+// program to exchange data with.
+
+void Fl_Headless_System_Driver::copy(const char *stuff, int len, int clipboard, const char *type) {
+  if (!stuff || len<0) return;
+
+  if (clipboard >= 2) {
+    copy(stuff, len, 0, type);
+    copy(stuff, len, 1, type);
+    return;
+  }
+
+  delete[] selection_[clipboard];
+  selection_[clipboard] = new char[len+1];
+  memcpy(selection_[clipboard], stuff, len);
+  selection_[clipboard][len] = 0; // needed for direct paste
+  selection_length_[clipboard] = len;
+  if (clipboard == 1) {
+    delete clipboard_image_;
+    clipboard_image_ = NULL;
+  }
+}
+
+
+/** Puts an image in the clipboard, which takes ownership of it */
+void Fl_Headless_System_Driver::copy_image(Fl_RGB_Image *image) {
+  delete clipboard_image_;
+  clipboard_image_ = image;
+  delete[] selection_[1];
+  selection_[1] = NULL;
+  selection_length_[1] = 0;
+}
+
+
+void Fl_Headless_System_Driver::paste(Fl_Widget &receiver, int clipboard, const char *type) {
+  if (clipboard < 0 || clipboard > 1) return;
+  int image = (strcmp(type, Fl::clipboard_image) == 0);
+  if (image ? (clipboard != 1 || !clipboard_image_) : !selection_[clipboard]) return;
+  int old_event = Fl::e_number;
+  Fl::e_number = FL_PASTE;
+  if (image) {
+    Fl::e_clipboard_type = Fl::clipboard_image;
+    Fl::e_clipboard_data = clipboard_image_->copy();
+    if (!receiver.handle(FL_PASTE)) {
+      delete (Fl_RGB_Image*)Fl::e_clipboard_data;
+      Fl::e_clipboard_data = NULL;
+    }
+  } else {
+    Fl::e_clipboard_type = Fl::clipboard_plain_text;
+    Fl::e_text = selection_[clipboard];
+    Fl::e_length = selection_length_[clipboard];
+    receiver.handle(FL_PASTE);
+  }
+  Fl::e_number = old_event;
+}
+
+
+int Fl_Headless_System_Driver::clipboard_contains(const char *type) {
+  if (strcmp(type, Fl::clipboard_image) == 0) return clipboard_image_ != NULL;
+  if (strcmp(type, Fl::clipboard_plain_text) == 0) return selection_[1] != NULL;
+  return 0;
+}
+
+
+//
+// End of "$Id$".
+//
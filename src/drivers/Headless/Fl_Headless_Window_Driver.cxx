@@ -0,0 +1,236 @@
+//
+// "$Id$"
+//
+// Definition of the headless Window interface
+// for the Fast Light Tool Kit (FLTK).
+//
+// Copyright 2018 by Bill Spitzak and others.
+//
+// This library is free software. Distribution and use rights are outlined in
+// the file "COPYING" which should have been included with this file.  If this
+// file is missing or damaged, see the license at:
+//
+//     http://www.fltk.org/COPYING.php
+//
+// Please report all bugs and problems on the following page:
+//
+//     http://www.fltk.org/str.php
+//
+
+
+#include "../../config_lib.h"
+#include "Fl_Headless_Window_Driver.H"
+#include "Fl_Headless_Screen_Driver.H"
+#include "../Raster/Fl_Raster_Graphics_Driver.H"
+
+#include <FL/platform.H>
+#include <FL/Fl.H>
+#include <FL/Fl_Window.H>
+#include <string.h>
+
+Window fl_window;
+
+extern Fl_Window *fl_xfocus; // in Fl.cxx
+extern void fl_fix_focus();  // in Fl.cxx
+
+
+Fl_Window_Driver *Fl_Window_Driver::newWindowDriver(Fl_Window *win)
+{
+  return new Fl_Headless_Window_Driver(win);
+}
+
+
+void Fl_Window_Driver::default_icons(Fl_RGB_Image const**, int) {
+}
+
+
+Fl_Headless_Window_Driver::Fl_Headless_Window_Driver(Fl_Window *win)
+: Fl_Pico_Window_Driver(win)
+{
+  pixels_ = composite_ = NULL;
+  pixels_w_ = pixels_h_ = 0;
+}
+
+
+Fl_Headless_Window_Driver::~Fl_Headless_Window_Driver()
+{
+  delete[] pixels_;
+  delete[] composite_;
+}
+
+
+// (Re)allocates the pixels for the size of the window, in black
+void Fl_Headless_Window_Driver::alloc_pixels()
+{
+  delete[] pixels_;
+  delete[] composite_;
+  composite_ = NULL;
+  pixels_w_ = w() > 0 ? w() : 0;
+  pixels_h_ = h() > 0 ? h() : 0;
+  pixels_ = new unsigned[pixels_w_ * pixels_h_ + 1];
+  memset(pixels_, 0, pixels_w_ * pixels_h_ * sizeof(unsigned));
+}
+
+
+void Fl_Headless_Window_Driver::show() {
+  if (!shown()) {
+    makeWindow();
+  }
+}
+
+
+Fl_X *Fl_Headless_Window_Driver::makeWindow()
+{
+  Fl_Group::current(0);
+  if (parent() && !Fl_X::i(pWindow->window())) {
+    pWindow->set_visible();
+    return 0L;
+  }
+  alloc_pixels();
+  Fl_X *x = new Fl_X;
+  other_xid = 0;
+  x->w = pWindow;
+  x->region = 0;
+  x->xid = (Window)this;
+  x->next = Fl_X::first;
+  wait_for_expose_value = 0;
+  i(x);
+  Fl_X::first = x;
+
+  pWindow->set_visible();
+  pWindow->redraw();
+  int old_event = Fl::e_number;
+  pWindow->handle(Fl::e_number = FL_SHOW);
+  Fl::e_number = old_event;
+
+  // a new window gets the focus, as a window manager would give it,
+  // unless it is a menu or a tooltip:
+  if (!parent() && !pWindow->override()) {
+    fl_xfocus = pWindow;
+    fl_fix_focus();
+  }
+  return x;
+}
+
+
+void Fl_Headless_Window_Driver::make_current()
+{
+  fl_window = fl_xid(pWindow);
+  Fl_Raster_Graphics_Driver *d = (Fl_Raster_Graphics_Driver*)&Fl_Graphics_Driver::default_driver();
+  if (d->buffer() != pixels_) d->buffer(pixels_, pixels_w_, pixels_h_);
+  else d->clip_region(0);
+}
+
+
+void Fl_Headless_Window_Driver::flush()
+{
+  double start = Fl_Headless_Screen_Driver::now();
+  Fl_Pico_Window_Driver::flush();
+  Fl_Headless_Screen_Driver::stats.draw_time += Fl_Headless_Screen_Driver::now() - start;
+  Fl_Headless_Screen_Driver::stats.frames++;
+  Fl_Headless_Screen_Driver::stats.pixels += repainted_pixels();
+}
+
+
+void Fl_Headless_Window_Driver::resize(int X, int Y, int W, int H)
+{
+  int is_a_move = (X != x() || Y != y());
+  int is_a_resize = (W != w() || H != h() || is_a_rescale());
+  if (is_a_move) force_position(1);
+  else if (!is_a_resize) return;
+  if (is_a_resize) {
+    pWindow->Fl_Group::resize(X,Y,W,H);
+    if (shown()) {
+      alloc_pixels();
+      pWindow->redraw();
+    }
+  } else {
+    x(X); y(Y);
+  }
+}
+
+
+void Fl_Headless_Window_Driver::hide()
+{
+  Fl_X* ip = Fl_X::i(pWindow);
+  if (hide_common()) return;
+  ((Fl_Headless_Screen_Driver*)Fl::screen_driver())->forget(pWindow);
+  if (fl_window == ip->xid) fl_window = 0;
+  Fl_Raster_Graphics_Driver *d = (Fl_Raster_Graphics_Driver*)&Fl_Graphics_Driver::default_driver();
+  if (d->buffer() == pixels_) d->buffer(NULL, 0, 0);
+  delete[] pixels_;
+  delete[] composite_;
+  pixels_ = composite_ = NULL;
+  pixels_w_ = pixels_h_ = 0;
+  delete ip;
+}
+
+
+
+// Shifts the pixels of whatever the current raster driver draws into: the
+// window, or an offscreen while one is the current surface
+int Fl_Headless_Window_Driver::scroll(int src_x, int src_y, int src_w, int src_h, int dest_x, int dest_y,
+                                      void (*draw_area)(void*, int,int,int,int), void* data)
+{
+  ((Fl_Raster_Graphics_Driver*)fl_graphics_driver)->copy_area(src_x, src_y, src_w, src_h, dest_x, dest_y);
+  return 0;
+}
+
+// Copies the pixels of the shown subwindows of g, whose window is at x,y
+// in the top-level window, clipped to the rectangle l,t,r,b
+void Fl_Headless_Window_Driver::composite(Fl_Group *g, int x, int y, int l, int t, int r, int b)
+{
+  for (int i = 0; i < g->children(); i++) {
+    Fl_Widget *o = g->child(i);
+    if (!o->visible()) continue;
+    Fl_Window *win = o->as_window();
+    if (!win) {
+      if (o->as_group()) composite(o->as_group(), x, y, l, t, r, b);
+      continue;
+    }
+    Fl_Headless_Window_Driver *d = (Fl_Headless_Window_Driver*)driver(win);
+    if (!win->shown() || !d->pixels_) continue;
+    int wx = x + win->x(), wy = y + win->y();
+    int wl = wx > l ? wx : l, wt = wy > t ? wy : t;
+    int wr = wx + d->pixels_w_ < r ? wx + d->pixels_w_ : r;
+    int wb = wy + d->pixels_h_ < b ? wy + d->pixels_h_ : b;
+    if (wl >= wr || wt >= wb) continue;
+    for (int j = wt; j < wb; j++) {
+      memcpy(composite_ + j * pixels_w_ + wl,
+             d->pixels_ + (j - wy) * d->pixels_w_ + wl - wx,
+             (wr - wl) * sizeof(unsigned));
+    }
+    composite(win, wx, wy, wl, wt, wr, wb);
+  }
+}
+
+
+/**
+ Returns the pixels of the window, with those of its subwindows.
+ */
+const unsigned *Fl_Headless_Window_Driver::pixels(int *w, int *h)
+{
+  *w = pixels_w_;
+  *h = pixels_h_;
+  int subwindows = 0;
+  for (Fl_X *i = Fl_X::first; i; i = i->next) {
+    if (i->w != pWindow && i->w->top_window() == pWindow) subwindows = 1;
+  }
+  if (!subwindows || !pixels_) return pixels_;
+  if (!composite_) composite_ = new unsigned[pixels_w_ * pixels_h_ + 1];
+  memcpy(composite_, pixels_, pixels_w_ * pixels_h_ * sizeof(unsigned));
+  composite(pWindow, 0, 0, 0, 0, pixels_w_, pixels_h_);
+  return composite_;
+}
+
+
+const unsigned *fl_headless_pixels(const Fl_Window *win, int *w, int *h)
+{
+  if (!Fl_X::i(win)) return NULL;
+  Fl_Headless_Window_Driver *d = (Fl_Headless_Window_Driver*)Fl_Window_Driver::driver(win);
+  return d->pixels(w, h);
+}
+
+//
+// End of "$Id$".
+//
@@ -0,0 +1,1103 @@
+//
+// "$Id$"
+//
+// Platform-independent raster graphics driver for the Fast Light Tool Kit (FLTK).
+//
+// Copyright 2010-2018 by Bill Spitzak and others.
+//
+// This library is free software. Distribution and use rights are outlined in
+// the file "COPYING" which should have been included with this file.  If this
+// file is missing or damaged, see the license at:
+//
+//     http://www.fltk.org/COPYING.php
+//
+// Please report all bugs and problems on the following page:
+//
+//     http://www.fltk.org/str.php
+//
+
+#include "../../config_lib.h"
+#include "Fl_Raster_Graphics_Driver.H"
+#include "Fl_Raster_Image_Surface_Driver.H"
+#include <FL/Fl.H>
+#include <FL/fl_draw.H>
+#include <FL/Fl_Image.H>
+#include <FL/Fl_Bitmap.H>
+#include <FL/Fl_Pixmap.H>
+#include <FL/math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ All drawings end up in three kinds of operations on the pixels: solid
+ horizontal spans, which are the inner loop of rectangles and polygons
+ and which the compiler turns into vector stores; single pixels, for
+ lines one pixel wide; and spans where each pixel has its own coverage,
+ for antialiased edges. Each of them is clipped by the rectangles of
+ the current clip level.
+
+ Polygons, wide lines and pies are converted to a list of edges that
+ fill_edges() scans line by line, sampling the center of each pixel, as
+ X11 does. With antialiasing, each row of pixels is sampled 4 times and
+ the coverage of the pixels at the ends of each span is computed exactly.
+ */
+
+// number of samples per row of pixels when antialiasing
+#define SUBSAMPLES 4
+
+
+// Sets n pixels to v...
+static inline void fill_pixels(unsigned *p, int n, unsigned v) {
+  for (int i = 0; i < n; i++) p[i] = v;
+}
+
+// Returns pixel d blended with s with coverage a, 0 <= a <= 256...
+static inline unsigned blend_pixel(unsigned d, unsigned s, unsigned a) {
+  unsigned ia = 256 - a;
+  return ((((s & 0xff00ff) * a + (d & 0xff00ff) * ia) >> 8) & 0xff00ff) |
+         ((((s & 0xff00) * a + (d & 0xff00) * ia) >> 8) & 0xff00);
+}
+
+static inline int round_coord(double v) { return (int)floor(v + 0.5); }
+
+
+Fl_Raster_Graphics_Driver::Fl_Raster_Graphics_Driver() {
+  buffer_ = 0;
+  width_ = height_ = stride_ = 0;
+  pixel_ = 0;
+  antialias_ = 0;
+  line_width_ = line_cap_ = line_join_ = 0;
+  ndashes_ = 0;
+  offset_x_ = offset_y_ = 0;
+  depth_ = 0;
+  clip_ = 0;
+  clip_size_ = 0;
+  clip_start_[0] = clip_count_[0] = 0;
+  points_ = 0;
+  npoints_ = points_size_ = 0;
+  edges_ = 0;
+  nedges_ = edges_size_ = 0;
+  crossings_ = 0;
+  crossings_size_ = 0;
+  cover_ = 0;
+  cover_size_ = 0;
+}
+
+
+Fl_Raster_Graphics_Driver::~Fl_Raster_Graphics_Driver() {
+  free(clip_);
+  free(points_);
+  free(edges_);
+  free(crossings_);
+  free(cover_);
+}
+
+
+/** Sets the pixels the driver draws into.
+ \param pixels w x h pixels of value 0x00RRGGBB, which remain owned by the caller
+ \param w, h size of the buffer in pixels
+ \param stride number of pixels from one row to the next, or 0 for \p w
+ The clip stack is reset to the whole buffer.
+ */
+void Fl_Raster_Graphics_Driver::buffer(unsigned *pixels, int w, int h, int stride) {
+  buffer_ = pixels;
+  width_ = w;
+  height_ = h;
+  stride_ = stride ? stride : w;
+  while (rstackptr > 0) pop_clip();
+  set_no_clip();
+}
+
+
+void Fl_Raster_Graphics_Driver::translate_all(int dx, int dy) { // reversibly adds dx,dy to the offset between user and graphical coordinates
+  if (depth_ < FL_RASTER_GRAPHICS_TRANSLATION_STACK_SIZE) {
+    stack_x_[depth_] = offset_x_;
+    stack_y_[depth_] = offset_y_;
+    depth_++;
+  } else {
+    Fl::warning("%s: translate stack overflow!", "Fl_Raster_Graphics_Driver");
+  }
+  offset_x_ += dx;
+  offset_y_ += dy;
+  push_matrix();
+  translate(dx, dy);
+}
+
+
+void Fl_Raster_Graphics_Driver::untranslate_all() { // undoes previous translate_all()
+  if (depth_ > 0) depth_--;
+  offset_x_ = stack_x_[depth_];
+  offset_y_ = stack_y_[depth_];
+  pop_matrix();
+}
+
+
+// --- clipping
+
+// Makes room for n clip rectangles in all levels...
+void Fl_Raster_Graphics_Driver::reserve_clip(int n) {
+  if (n <= clip_size_) return;
+  clip_size_ = n + 16;
+  clip_ = (Clip_Rect*)realloc(clip_, clip_size_ * sizeof(Clip_Rect));
+}
+
+
+// Sets the current clip level to the whole buffer...
+void Fl_Raster_Graphics_Driver::set_no_clip() {
+  int start = rstackptr ? clip_start_[rstackptr-1] + clip_count_[rstackptr-1] : 0;
+  reserve_clip(start + 1);
+  Clip_Rect &c = clip_[start];
+  c.x = c.y = 0;
+  c.r = width_;
+  c.b = height_;
+  clip_start_[rstackptr] = start;
+  clip_count_[rstackptr] = (width_ > 0 && height_ > 0);
+}
+
+
+// Computes the bounding box of the current clip, returns 0 if it is empty...
+int Fl_Raster_Graphics_Driver::clip_bounds(Clip_Rect &b) {
+  const Clip_Rect *c = clip_ + clip_start_[rstackptr], *e = c + clip_count_[rstackptr];
+  if (c == e) return 0;
+  b = *c;
+  for (c++; c < e; c++) {
+    if (c->x < b.x) b.x = c->x;
+    if (c->y < b.y) b.y = c->y;
+    if (c->r > b.r) b.r = c->r;
+    if (c->b > b.b) b.b = c->b;
+  }
+  return 1;
+}
+
+
+void Fl_Raster_Graphics_Driver::push_clip(int x, int y, int w, int h) {
+  if (rstackptr >= region_stack_max) {
+    Fl::warning("Fl_Raster_Graphics_Driver::push_clip: clip stack overflow!\n");
+    return;
+  }
+  x += offset_x_; y += offset_y_;
+  int r = x + w, b = y + h;
+  int prev = rstackptr++;
+  int start = clip_start_[prev] + clip_count_[prev];
+  reserve_clip(start + clip_count_[prev]);
+  int n = 0;
+  for (int i = 0; i < clip_count_[prev]; i++) {
+    const Clip_Rect &c = clip_[clip_start_[prev] + i];
+    Clip_Rect &d = clip_[start + n];
+    d.x = x > c.x ? x : c.x;
+    d.y = y > c.y ? y : c.y;
+    d.r = r < c.r ? r : c.r;
+    d.b = b < c.b ? b : c.b;
+    if (d.x < d.r && d.y < d.b) n++;
+  }
+  clip_start_[rstackptr] = start;
+  clip_count_[rstackptr] = n;
+  rstack[rstackptr] = 0;
+  restore_clip();
+}
+
+
+void Fl_Raster_Graphics_Driver::push_no_clip() {
+  if (rstackptr >= region_stack_max) {
+    Fl::warning("Fl_Raster_Graphics_Driver::push_no_clip: clip stack overflow!\n");
+    return;
+  }
+  rstackptr++;
+  set_no_clip();
+  rstack[rstackptr] = 0;
+  restore_clip();
+}
+
+
+void Fl_Raster_Graphics_Driver::pop_clip() {
+  if (rstackptr > 0) {
+    Fl_Region oldr = rstack[rstackptr--];
+    if (oldr) XDestroyRegion(oldr);
+  } else Fl::warning("Fl_Raster_Graphics_Driver::pop_clip: clip stack underflow!\n");
+  restore_clip();
+}
+
+
+/** Replaces the top of the clip stack.
+ Fl_Region is platform-specific, so this driver does not clip to \p r
+ but to the whole buffer, as when \p r is NULL.
+ */
+void Fl_Raster_Graphics_Driver::clip_region(Fl_Region r) {
+  set_no_clip();
+  Fl_Graphics_Driver::clip_region(r);
+}
+
+
+int Fl_Raster_Graphics_Driver::not_clipped(int x, int y, int w, int h) {
+  x += offset_x_; y += offset_y_;
+  const Clip_Rect *c = clip_ + clip_start_[rstackptr], *e = c + clip_count_[rstackptr];
+  for (; c < e; c++) {
+    if (x < c->r && y < c->b && x + w > c->x && y + h > c->y) return 1;
+  }
+  return 0;
+}
+
+
+int Fl_Raster_Graphics_Driver::clip_box(int x, int y, int w, int h, int &X, int &Y, int &W, int &H) {
+  X = x; Y = y; W = w; H = h;
+  Clip_Rect b;
+  if (!not_clipped(x, y, w, h) || !clip_bounds(b)) {
+    W = H = 0;
+    return 2;
+  }
+  b.x -= offset_x_; b.r -= offset_x_;
+  b.y -= offset_y_; b.b -= offset_y_;
+  if (X < b.x) { W -= b.x - X; X = b.x; }
+  if (Y < b.y) { H -= b.y - Y; Y = b.y; }
+  if (X + W > b.r) W = b.r - X;
+  if (Y + H > b.b) H = b.b - Y;
+  return (X != x || Y != y || W != w || H != h);
+}
+
+
+// --- pixel operations
+
+// Fills pixels x to r - 1 of row y with the current color...
+void Fl_Raster_Graphics_Driver::span(int y, int x, int r) {
+  const Clip_Rect *c = clip_ + clip_start_[rstackptr], *e = c + clip_count_[rstackptr];
+  for (; c < e; c++) {
+    if (y < c->y || y >= c->b) continue;
+    int a = x > c->x ? x : c->x, b = r < c->r ? r : c->r;
+    if (a < b) fill_pixels(buffer_ + y * stride_ + a, b - a, pixel_);
+  }
+}
+
+
+void Fl_Raster_Graphics_Driver::plot(int x, int y) {
+  const Clip_Rect *c = clip_ + clip_start_[rstackptr], *e = c + clip_count_[rstackptr];
+  for (; c < e; c++) {
+    if (x >= c->x && x < c->r && y >= c->y && y < c->b) {
+      buffer_[y * stride_ + x] = pixel_;
+      return;
+    }
+  }
+}
+
+
+// Fills the area from x,y to r - 1,b - 1 with the current color...
+void Fl_Raster_Graphics_Driver::fill_area(int x, int y, int r, int b) {
+  const Clip_Rect *c = clip_ + clip_start_[rstackptr], *e = c + clip_count_[rstackptr];
+  for (; c < e; c++) {
+    int x0 = x > c->x ? x : c->x, x1 = r < c->r ? r : c->r;
+    int y0 = y > c->y ? y : c->y, y1 = b < c->b ? b : c->b;
+    if (x0 >= x1) continue;
+    for (int j = y0; j < y1; j++) fill_pixels(buffer_ + j * stride_ + x0, x1 - x0, pixel_);
+  }
+}
+
+
+// --- colors and line styles
+
+void Fl_Raster_Graphics_Driver::color(Fl_Color c) {
+  color_ = c;
+  pixel_ = Fl::get_color(c) >> 8;
+}
+
+
+void Fl_Raster_Graphics_Driver::color(uchar r, uchar g, uchar b) {
+  color_ = fl_rgb_color(r, g, b);
+  pixel_ = (r << 16) | (g << 8) | b;
+}
+
+
+void Fl_Raster_Graphics_Driver::line_style(int style, int width, char* dashes) {
+  line_width_ = width;
+  line_cap_ = (style >> 8) & 3;
+  line_join_ = (style >> 12) & 3;
+  ndashes_ = 0;
+  if (dashes && *dashes) {
+    while (ndashes_ < (int)sizeof(dashes_) && dashes[ndashes_]) {
+      dashes_[ndashes_] = dashes[ndashes_];
+      ndashes_++;
+    }
+    return;
+  }
+  // same dash patterns as the Xlib driver
+  int w = width ? width : 1;
+  char dash, dot, gap;
+  if (style & 0x200) {
+    dash = char(2*w);
+    dot = 1;
+    gap = char(2*w-1);
+  } else {
+    dash = char(3*w);
+    dot = gap = char(w);
+  }
+  char *p = dashes_;
+  switch (style & 0xff) {
+    case FL_DASH:	*p++ = dash; *p++ = gap; break;
+    case FL_DOT:	*p++ = dot; *p++ = gap; break;
+    case FL_DASHDOT:	*p++ = dash; *p++ = gap; *p++ = dot; *p++ = gap; break;
+    case FL_DASHDOTDOT: *p++ = dash; *p++ = gap; *p++ = dot; *p++ = gap; *p++ = dot; *p++ = gap; break;
+  }
+  ndashes_ = int(p - dashes_);
+}
+
+
+// --- paths
+
+// Draws a path of lines one pixel wide through the pixels nearest to its
+// points, with Bresenham's algorithm. The dash pattern goes on from one
+// segment to the next...
+void Fl_Raster_Graphics_Driver::thin_path(const Point *p, int n, int closed) {
+  int segments = closed ? n : n - 1, i = 0;
+  int x = round_coord(p[0].x), y = round_coord(p[0].y);
+  int dx = 0, dy = 0, sx = 0, sy = 0, err = 0, steps = 0;
+  int dash = 0, left = ndashes_ ? dashes_[0] : 0;
+  for (;;) {
+    if (!(dash & 1)) plot(x, y);
+    if (ndashes_ && --left <= 0) {
+      dash = (dash + 1) % ndashes_;
+      left = dashes_[dash];
+    }
+    while (!steps) { // go to the next segment
+      if (i >= segments) return;
+      i++;
+      int x1 = round_coord(p[i % n].x), y1 = round_coord(p[i % n].y);
+      dx = abs(x1 - x); dy = abs(y1 - y);
+      sx = x < x1 ? 1 : -1; sy = y < y1 ? 1 : -1;
+      err = dx - dy;
+      steps = dx > dy ? dx : dy;
+    }
+    int e2 = 2 * err;
+    if (e2 > -dy) { err -= dy; x += sx; }
+    if (e2 < dx) { err += dx; y += sy; }
+    steps--;
+  }
+}
+
+
+// Adds the edges of a polygon with the same orientation as all others
+// added by this function, so that they fill their union with the
+// non-zero winding rule...
+void Fl_Raster_Graphics_Driver::add_convex(const Point *p, int n) {
+  double area = 0;
+  for (int i = 0; i < n; i++) {
+    const Point &a = p[i], &b = p[(i + 1) % n];
+    area += a.x * b.y - b.x * a.y;
+  }
+  for (int i = 0; i < n; i++) {
+    const Point &a = p[i], &b = p[(i + 1) % n];
+    if (area >= 0) add_edge(a.x, a.y, b.x, b.y);
+    else add_edge(b.x, b.y, a.x, a.y);
+  }
+}
+
+
+void Fl_Raster_Graphics_Driver::add_disc(double x, double y, double r) {
+  Point q[64];
+  int n = int(8 + 4 * sqrt(r));
+  if (n > 64) n = 64;
+  for (int i = 0; i < n; i++) {
+    q[i].x = x + r * cos(2 * M_PI * i / n);
+    q[i].y = y + r * sin(2 * M_PI * i / n);
+  }
+  add_convex(q, n);
+}
+
+
+// Fills the outline of a path drawn with a line of width line_width_,
+// with its caps and joins...
+void Fl_Raster_Graphics_Driver::wide_path(const Point *p, int n, int closed) {
+  double half = (line_width_ > 1 ? line_width_ : 1) / 2.0;
+  int segments = closed ? n : n - 1;
+  Point q[4];
+  for (int i = 0; i < segments; i++) {
+    Point a = p[i], b = p[(i + 1) % n];
+    double dx = b.x - a.x, dy = b.y - a.y, len = sqrt(dx * dx + dy * dy);
+    if (len == 0) continue;
+    dx /= len; dy /= len;
+    if (!closed && line_cap_ == 3) { // FL_CAP_SQUARE
+      if (i == 0) { a.x -= dx * half; a.y -= dy * half; }
+      if (i == segments - 1) { b.x += dx * half; b.y += dy * half; }
+    }
+    double nx = -dy * half, ny = dx * half;
+    q[0].x = a.x + nx; q[0].y = a.y + ny;
+    q[1].x = b.x + nx; q[1].y = b.y + ny;
+    q[2].x = b.x - nx; q[2].y = b.y - ny;
+    q[3].x = a.x - nx; q[3].y = a.y - ny;
+    add_convex(q, 4);
+  }
+  if (!closed && line_cap_ == 2) { // FL_CAP_ROUND
+    add_disc(p[0].x, p[0].y, half);
+    add_disc(p[n-1].x, p[n-1].y, half);
+  }
+  // joins between segments
+  for (int i = closed ? 0 : 1; i < (closed ? n : n - 1); i++) {
+    const Point &a = p[(i + n - 1) % n], &v = p[i], &b = p[(i + 1) % n];
+    double d0x = v.x - a.x, d0y = v.y - a.y, d1x = b.x - v.x, d1y = b.y - v.y;
+    double l0 = sqrt(d0x * d0x + d0y * d0y), l1 = sqrt(d1x * d1x + d1y * d1y);
+    if (l0 == 0 || l1 == 0) continue;
+    d0x /= l0; d0y /= l0; d1x /= l1; d1y /= l1;
+    double cross = d0x * d1y - d0y * d1x, dot = d0x * d1x + d0y * d1y;
+    if (fabs(cross) < 1e-9 && dot > 0) continue;
+    if (line_join_ == 2) { // FL_JOIN_ROUND
+      add_disc(v.x, v.y, half);
+      continue;
+    }
+    double s = cross > 0 ? -half : half; // the outer side of the turn
+    q[0] = v;
+    q[1].x = v.x - d0y * s; q[1].y = v.y + d0x * s;
+    q[2].x = v.x - d1y * s; q[2].y = v.y + d1x * s;
+    if (line_join_ != 3 && 1 + dot > 0.02) { // FL_JOIN_MITER, unless too sharp
+      double mx = -(d0y + d1y), my = d0x + d1x, k = s / (1 + dot);
+      q[3] = q[2];
+      q[2].x = v.x + mx * k; q[2].y = v.y + my * k;
+      add_convex(q, 4);
+    } else add_convex(q, 3);
+  }
+  fill_edges(1);
+}
+
+
+// Draws a path with the current line style. The points are in pixel
+// coordinates, the center of pixel x,y being at x,y...
+void Fl_Raster_Graphics_Driver::stroke(const Point *p, int n, int closed) {
+  if (n < 1 || !buffer_) return;
+  if ((line_width_ <= 1 && !antialias_) || n == 1) {
+    thin_path(p, n, closed);
+    return;
+  }
+  // the geometry of wide lines has pixel centers at x + 0.5,y + 0.5
+  Point *q = new Point[n + 1];
+  for (int i = 0; i < n; i++) { q[i].x = p[i].x + 0.5; q[i].y = p[i].y + 0.5; }
+  if (!ndashes_) {
+    wide_path(q, n, closed);
+    delete[] q;
+    return;
+  }
+  // cut the path in dashes, each drawn as an open path
+  if (closed) { q[n] = q[0]; n++; }
+  int dash = 0, pn = 0;
+  double left = dashes_[0];
+  Point *piece = new Point[n + 1];
+  piece[pn++] = q[0];
+  for (int i = 0; i + 1 < n; i++) {
+    Point a = q[i];
+    const Point &b = q[i + 1];
+    double dx = b.x - a.x, dy = b.y - a.y, len = sqrt(dx * dx + dy * dy);
+    while (len > 0) {
+      if (len < left) {
+        left -= len;
+        if (!(dash & 1)) piece[pn++] = b;
+        break;
+      }
+      Point c;
+      c.x = a.x + dx * left / len; c.y = a.y + dy * left / len;
+      if (!(dash & 1)) {
+        piece[pn++] = c;
+        wide_path(piece, pn, 0);
+      }
+      pn = 0;
+      piece[pn++] = c;
+      dx = b.x - c.x; dy = b.y - c.y;
+      len -= left;
+      a = c;
+      dash = (dash + 1) % ndashes_;
+      left = dashes_[dash];
+    }
+  }
+  if (!(dash & 1) && pn > 1) wide_path(piece, pn, 0);
+  delete[] piece;
+  delete[] q;
+}
+
+
+void Fl_Raster_Graphics_Driver::point(int x, int y) {
+  if (buffer_) plot(x + offset_x_, y + offset_y_);
+}
+
+
+void Fl_Raster_Graphics_Driver::xyline(int x, int y, int x1) {
+  if (!buffer_) return;
+  if (line_width_ <= 1 && !ndashes_) {
+    if (x1 < x) { int t = x; x = x1; x1 = t; }
+    span(y + offset_y_, x + offset_x_, x1 + offset_x_ + 1);
+    return;
+  }
+  line(x, y, x1, y);
+}
+
+
+void Fl_Raster_Graphics_Driver::yxline(int x, int y, int y1) {
+  if (!buffer_) return;
+  if (line_width_ <= 1 && !ndashes_) {
+    if (y1 < y) { int t = y; y = y1; y1 = t; }
+    fill_area(x + offset_x_, y + offset_y_, x + offset_x_ + 1, y1 + offset_y_ + 1);
+    return;
+  }
+  line(x, y, x, y1);
+}
+
+
+void Fl_Raster_Graphics_Driver::xyline(int x, int y, int x1, int y2) {
+  line(x, y, x1, y, x1, y2);
+}
+
+
+void Fl_Raster_Graphics_Driver::xyline(int x, int y, int x1, int y2, int x3) {
+  Point p[4] = {{double(x), double(y)}, {double(x1), double(y)},
+                {double(x1), double(y2)}, {double(x3), double(y2)}};
+  for (int i = 0; i < 4; i++) { p[i].x += offset_x_; p[i].y += offset_y_; }
+  stroke(p, 4, 0);
+}
+
+
+void Fl_Raster_Graphics_Driver::yxline(int x, int y, int y1, int x2) {
+  line(x, y, x, y1, x2, y1);
+}
+
+
+void Fl_Raster_Graphics_Driver::yxline(int x, int y, int y1, int x2, int y3) {
+  Point p[4] = {{double(x), double(y)}, {double(x), double(y1)},
+                {double(x2), double(y1)}, {double(x2), double(y3)}};
+  for (int i = 0; i < 4; i++) { p[i].x += offset_x_; p[i].y += offset_y_; }
+  stroke(p, 4, 0);
+}
+
+
+void Fl_Raster_Graphics_Driver::line(int x, int y, int x1, int y1) {
+  Point p[2] = {{double(x + offset_x_), double(y + offset_y_)},
+                {double(x1 + offset_x_), double(y1 + offset_y_)}};
+  stroke(p, 2, 0);
+}
+
+
+void Fl_Raster_Graphics_Driver::line(int x, int y, int x1, int y1, int x2, int y2) {
+  Point p[3] = {{double(x), double(y)}, {double(x1), double(y1)}, {double(x2), double(y2)}};
+  for (int i = 0; i < 3; i++) { p[i].x += offset_x_; p[i].y += offset_y_; }
+  stroke(p, 3, 0);
+}
+
+
+void Fl_Raster_Graphics_Driver::rect(int x, int y, int w, int h) {
+  if (w <= 0 || h <= 0 || !buffer_) return;
+  x += offset_x_; y += offset_y_;
+  int r = x + w - 1, b = y + h - 1;
+  if (line_width_ <= 1 && !ndashes_) {
+    span(y, x, r + 1);
+    span(b, x, r + 1);
+    fill_area(x, y, x + 1, b + 1);
+    fill_area(r, y, r + 1, b + 1);
+    return;
+  }
+  Point p[4] = {{double(x), double(y)}, {double(r), double(y)},
+                {double(r), double(b)}, {double(x), double(b)}};
+  stroke(p, 4, 1);
+}
+
+
+void Fl_Raster_Graphics_Driver::rectf(int x, int y, int w, int h) {
+  if (w <= 0 || h <= 0 || !buffer_) return;
+  x += offset_x_; y += offset_y_;
+  fill_area(x, y, x + w, y + h);
+}
+
+
+void Fl_Raster_Graphics_Driver::loop(int x0, int y0, int x1, int y1, int x2, int y2) {
+  Point p[3] = {{double(x0), double(y0)}, {double(x1), double(y1)}, {double(x2), double(y2)}};
+  for (int i = 0; i < 3; i++) { p[i].x += offset_x_; p[i].y += offset_y_; }
+  stroke(p, 3, 1);
+}
+
+
+void Fl_Raster_Graphics_Driver::loop(int x0, int y0, int x1, int y1, int x2, int y2, int x3, int y3) {
+  Point p[4] = {{double(x0), double(y0)}, {double(x1), double(y1)},
+                {double(x2), double(y2)}, {double(x3), double(y3)}};
+  for (int i = 0; i < 4; i++) { p[i].x += offset_x_; p[i].y += offset_y_; }
+  stroke(p, 4, 1);
+}
+
+
+void Fl_Raster_Graphics_Driver::polygon(int x0, int y0, int x1, int y1, int x2, int y2) {
+  Point p[3] = {{double(x0), double(y0)}, {double(x1), double(y1)}, {double(x2), double(y2)}};
+  for (int i = 0; i < 3; i++) { p[i].x += offset_x_; p[i].y += offset_y_; }
+  add_contour(p, 3);
+  fill_edges(0);
+}
+
+
+void Fl_Raster_Graphics_Driver::polygon(int x0, int y0, int x1, int y1, int x2, int y2, int x3, int y3) {
+  Point p[4] = {{double(x0), double(y0)}, {double(x1), double(y1)},
+                {double(x2), double(y2)}, {double(x3), double(y3)}};
+  for (int i = 0; i < 4; i++) { p[i].x += offset_x_; p[i].y += offset_y_; }
+  add_contour(p, 4);
+  fill_edges(0);
+}
+
+
+// --- polygon filling
+
+void Fl_Raster_Graphics_Driver::add_edge(double x0, double y0, double x1, double y1) {
+  if (y0 == y1) return;
+  if (nedges_ >= edges_size_) {
+    edges_size_ = edges_size_ ? 2 * edges_size_ : 64;
+    edges_ = (Edge*)realloc(edges_, edges_size_ * sizeof(Edge));
+  }
+  Edge &e = edges_[nedges_++];
+  e.dir = y0 < y1 ? 1 : -1;
+  if (y0 > y1) {
+    double t = x0; x0 = x1; x1 = t;
+    t = y0; y0 = y1; y1 = t;
+  }
+  e.x0 = x0; e.y0 = y0; e.y1 = y1;
+  e.dxdy = (x1 - x0) / (y1 - y0);
+}
+
+
+// Adds the edges of a closed contour...
+void Fl_Raster_Graphics_Driver::add_contour(const Point *p, int n) {
+  for (int i = 0; i < n; i++) {
+    const Point &a = p[i], &b = p[(i + 1) % n];
+    add_edge(a.x, a.y, b.x, b.y);
+  }
+}
+
+
+int Fl_Raster_Graphics_Driver::compare_edges(const void *a, const void *b) {
+  double ya = ((const Edge*)a)->y0, yb = ((const Edge*)b)->y0;
+  return ya < yb ? -1 : ya > yb;
+}
+
+
+// Fills the edges added since the last call, with the non-zero winding
+// rule or with the even-odd rule...
+void Fl_Raster_Graphics_Driver::fill_edges(int nonzero) {
+  Clip_Rect b;
+  if (!nedges_ || !buffer_ || !clip_bounds(b)) {
+    nedges_ = 0;
+    return;
+  }
+  double ymin = edges_[0].y0, ymax = edges_[0].y1, xmin = edges_[0].x0, xmax = xmin;
+  for (int i = 0; i < nedges_; i++) {
+    const Edge &e = edges_[i];
+    double x1 = e.x0 + (e.y1 - e.y0) * e.dxdy;
+    if (e.y0 < ymin) ymin = e.y0;
+    if (e.y1 > ymax) ymax = e.y1;
+    if (e.x0 < xmin) xmin = e.x0;
+    if (e.x0 > xmax) xmax = e.x0;
+    if (x1 < xmin) xmin = x1;
+    if (x1 > xmax) xmax = x1;
+  }
+  int y0 = ymin > b.y ? (int)floor(ymin) : b.y, y1 = ymax < b.b ? (int)ceil(ymax) : b.b;
+  int x0 = xmin > b.x ? (int)floor(xmin) : b.x, x1 = xmax < b.r - 1 ? (int)ceil(xmax) + 1 : b.r;
+  if (x0 >= x1 || y0 >= y1) {
+    nedges_ = 0;
+    return;
+  }
+  qsort(edges_, nedges_, sizeof(Edge), compare_edges);
+  if (crossings_size_ < nedges_) {
+    crossings_size_ = nedges_;
+    crossings_ = (Crossing*)realloc(crossings_, crossings_size_ * sizeof(Crossing));
+  }
+  int subsamples = antialias_ ? SUBSAMPLES : 1, weight = 256 / SUBSAMPLES;
+  if (antialias_) {
+    if (cover_size_ < x1 - x0 + 1) {
+      cover_size_ = x1 - x0 + 1;
+      cover_ = (int*)realloc(cover_, cover_size_ * sizeof(int));
+    }
+    memset(cover_, 0, (x1 - x0 + 1) * sizeof(int));
+  }
+  for (int y = y0; y < y1; y++) {
+    for (int s = 0; s < subsamples; s++) {
+      double sy = y + (s + 0.5) / subsamples;
+      // find the edges crossing this sample line, sorted by x
+      int n = 0;
+      for (int i = 0; i < nedges_ && edges_[i].y0 <= sy; i++) {
+        const Edge &e = edges_[i];
+        if (e.y1 <= sy) continue;
+        double x = e.x0 + (sy - e.y0) * e.dxdy;
+        int k = n++;
+        while (k > 0 && crossings_[k-1].x > x) { crossings_[k] = crossings_[k-1]; k--; }
+        crossings_[k].x = x;
+        crossings_[k].dir = e.dir;
+      }
+      // fill between crossings where the winding number says inside
+      int winding = 0;
+      double start = 0;
+      for (int k = 0; k < n; k++) {
+        int was_inside = nonzero ? winding != 0 : winding & 1;
+        winding += crossings_[k].dir;
+        int inside = nonzero ? winding != 0 : winding & 1;
+        if (inside == was_inside) continue;
+        if (inside) { start = crossings_[k].x; continue; }
+        double xa = start, xb = crossings_[k].x;
+        if (!antialias_) { // pixels whose center is in [xa, xb)
+          int a = (int)ceil(xa - 0.5), r = (int)ceil(xb - 0.5);
+          if (a < x0) a = x0;
+          if (r > x1) r = x1;
+          if (a < r) span(y, a, r);
+          continue;
+        }
+        if (xa < x0) xa = x0;
+        if (xb > x1) xb = x1;
+        if (xa >= xb) continue;
+        int ia = (int)floor(xa), ib = (int)floor(xb);
+        if (ia == ib) {
+          cover_[ia - x0] += int((xb - xa) * weight + 0.5);
+          continue;
+        }
+        cover_[ia - x0] += int((ia + 1 - xa) * weight + 0.5);
+        for (int i = ia + 1; i < ib; i++) cover_[i - x0] += weight;
+        cover_[ib - x0] += int((xb - ib) * weight + 0.5);
+      }
+    }
+    if (!antialias_) continue;
+    // blend the row with the coverage of its pixels
+    const Clip_Rect *c = clip_ + clip_start_[rstackptr], *e = c + clip_count_[rstackptr];
+    for (; c < e; c++) {
+      if (y < c->y || y >= c->b) continue;
+      int a = x0 > c->x ? x0 : c->x, r = x1 < c->r ? x1 : c->r;
+      unsigned *d = buffer_ + y * stride_;
+      for (int i = a; i < r; i++) {
+        int v = cover_[i - x0];
+        if (v >= 256) d[i] = pixel_;
+        else if (v > 0) d[i] = blend_pixel(d[i], pixel_, v);
+      }
+    }
+    memset(cover_, 0, (x1 - x0 + 1) * sizeof(int));
+  }
+  nedges_ = 0;
+}
+
+
+// --- vertices
+
+void Fl_Raster_Graphics_Driver::begin_points() {
+  what = POINT_;
+  npoints_ = nedges_ = 0;
+}
+
+
+void Fl_Raster_Graphics_Driver::begin_line() {
+  what = LINE;
+  npoints_ = nedges_ = 0;
+}
+
+
+void Fl_Raster_Graphics_Driver::begin_loop() {
+  what = LOOP;
+  npoints_ = nedges_ = 0;
+}
+
+
+void Fl_Raster_Graphics_Driver::begin_polygon() {
+  what = POLYGON;
+  npoints_ = nedges_ = 0;
+}
+
+
+void Fl_Raster_Graphics_Driver::begin_complex_polygon() {
+  what = POLYGON;
+  npoints_ = nedges_ = 0;
+}
+
+
+void Fl_Raster_Graphics_Driver::add_point(double x, double y) {
+  if (npoints_ && points_[npoints_-1].x == x && points_[npoints_-1].y == y) return;
+  if (npoints_ >= points_size_) {
+    points_size_ = points_size_ ? 2 * points_size_ : 64;
+    points_ = (Point*)realloc(points_, points_size_ * sizeof(Point));
+  }
+  points_[npoints_].x = x;
+  points_[npoints_].y = y;
+  npoints_++;
+}
+
+
+void Fl_Raster_Graphics_Driver::transformed_vertex(double xf, double yf) {
+  add_point(xf, yf);
+}
+
+
+void Fl_Raster_Graphics_Driver::vertex(double x, double y) {
+  add_point(x*m.a + y*m.c + m.x, x*m.b + y*m.d + m.y);
+}
+
+
+void Fl_Raster_Graphics_Driver::end_points() {
+  if (buffer_) {
+    for (int i = 0; i < npoints_; i++) plot(round_coord(points_[i].x), round_coord(points_[i].y));
+  }
+  npoints_ = 0;
+}
+
+
+void Fl_Raster_Graphics_Driver::end_line() {
+  stroke(points_, npoints_, 0);
+  npoints_ = 0;
+}
+
+
+void Fl_Raster_Graphics_Driver::end_loop() {
+  stroke(points_, npoints_, 1);
+  npoints_ = 0;
+}
+
+
+void Fl_Raster_Graphics_Driver::end_polygon() {
+  if (npoints_ > 2) add_contour(points_, npoints_);
+  npoints_ = 0;
+  fill_edges(0);
+}
+
+
+void Fl_Raster_Graphics_Driver::end_complex_polygon() {
+  end_polygon();
+}
+
+
+void Fl_Raster_Graphics_Driver::gap() {
+  switch (what) {
+    case POLYGON:
+      if (npoints_ > 2) add_contour(points_, npoints_);
+      break;
+    case LINE: stroke(points_, npoints_, 0); break;
+    case LOOP: stroke(points_, npoints_, 1); break;
+  }
+  npoints_ = 0;
+}
+
+
+// Replaces the current path with points of an ellipse from angle a1 to a2
+// in degrees, counter-clockwise from 3 o'clock...
+void Fl_Raster_Graphics_Driver::ellipse(double x, double y, double rx, double ry, double a1, double a2) {
+  npoints_ = 0;
+  int segs = int((a2 - a1) / 360 * (8 + 4 * sqrt(rx + ry)) * 2);
+  if (segs < 2) segs = 2;
+  for (int i = 0; i <= segs; i++) {
+    double a = (a1 + (a2 - a1) * i / segs) * M_PI / 180;
+    add_point(x + rx * cos(a), y - ry * sin(a));
+  }
+}
+
+
+void Fl_Raster_Graphics_Driver::circle(double x, double y, double r) {
+  double xt = transform_x(x, y), yt = transform_y(x, y);
+  double rx = r * (fabs(m.a) + fabs(m.c)), ry = r * (fabs(m.b) + fabs(m.d));
+  if (what == POLYGON) { // a filled circle covers the pixels whose center is in it
+    ellipse(xt, yt, rx, ry, 0, 360);
+    end_polygon();
+  } else {
+    ellipse(xt, yt, rx, ry, 0, 360);
+    stroke(points_, npoints_, 1);
+    npoints_ = 0;
+  }
+}
+
+
+void Fl_Raster_Graphics_Driver::arc(int x, int y, int w, int h, double a1, double a2) {
+  if (w <= 0 || h <= 0 || a2 <= a1) return;
+  x += offset_x_; y += offset_y_;
+  ellipse(x + (w - 1) / 2.0, y + (h - 1) / 2.0, (w - 1) / 2.0, (h - 1) / 2.0, a1, a2);
+  stroke(points_, npoints_, 0);
+  npoints_ = 0;
+}
+
+
+void Fl_Raster_Graphics_Driver::pie(int x, int y, int w, int h, double a1, double a2) {
+  if (w <= 0 || h <= 0 || a2 <= a1) return;
+  x += offset_x_; y += offset_y_;
+  double cx = x + w / 2.0, cy = y + h / 2.0;
+  ellipse(cx, cy, w / 2.0, h / 2.0, a1, a2);
+  if (a2 - a1 < 360) add_point(cx, cy);
+  end_polygon();
+}
+
+
+// --- images
+
+// Draws w pixels of depth d from p at x,y, converting gray to RGB when mono
+// is set, and blending them with their alpha when alpha is set...
+void Fl_Raster_Graphics_Driver::image_row(const uchar *p, int d, int x, int y, int w, int mono, int alpha) {
+  const Clip_Rect *c = clip_ + clip_start_[rstackptr], *e = c + clip_count_[rstackptr];
+  unsigned *row = buffer_ + y * stride_;
+  int ad = mono ? 1 : 3; // offset of alpha
+  for (; c < e; c++) {
+    if (y < c->y || y >= c->b) continue;
+    int a = x > c->x ? x : c->x, r = x + w < c->r ? x + w : c->r;
+    const uchar *q = p + (a - x) * d;
+    for (int i = a; i < r; i++, q += d) {
+      unsigned v = mono ? q[0] * 0x10101U : (q[0] << 16) | (q[1] << 8) | q[2];
+      if (alpha) {
+        unsigned k = q[ad];
+        if (!k) continue;
+        if (k != 255) v = blend_pixel(row[i], v, k + (k >> 7));
+      }
+      row[i] = v;
+    }
+  }
+}
+
+
+void Fl_Raster_Graphics_Driver::draw_image(const uchar* buf, int X, int Y, int W, int H, int D, int L) {
+  if (!buffer_) return;
+  if (!L) L = W * D;
+  X += offset_x_; Y += offset_y_;
+  int mono = abs(D) < 3;
+  for (int j = 0; j < H; j++) image_row(buf + j * L, D, X, Y + j, W, mono, 0);
+}
+
+
+void Fl_Raster_Graphics_Driver::draw_image_mono(const uchar* buf, int X, int Y, int W, int H, int D, int L) {
+  if (!buffer_) return;
+  if (!L) L = W * D;
+  X += offset_x_; Y += offset_y_;
+  for (int j = 0; j < H; j++) image_row(buf + j * L, D, X, Y + j, W, 1, 0);
+}
+
+
+void Fl_Raster_Graphics_Driver::draw_image(Fl_Draw_Image_Cb cb, void* data, int X, int Y, int W, int H, int D) {
+  int cx, cy, cw, ch;
+  clip_box(X, Y, W, H, cx, cy, cw, ch);
+  if (cw <= 0 || ch <= 0) return;
+  D = abs(D);
+  uchar *line = new uchar[cw * D];
+  for (int j = cy; j < cy + ch; j++) {
+    cb(data, cx - X, j - Y, cw, line);
+    draw_image(line, cx, j, cw, 1, D, 0);
+  }
+  delete[] line;
+}
+
+
+void Fl_Raster_Graphics_Driver::draw_image_mono(Fl_Draw_Image_Cb cb, void* data, int X, int Y, int W, int H, int D) {
+  int cx, cy, cw, ch;
+  clip_box(X, Y, W, H, cx, cy, cw, ch);
+  if (cw <= 0 || ch <= 0) return;
+  D = abs(D);
+  uchar *line = new uchar[cw * D];
+  for (int j = cy; j < cy + ch; j++) {
+    cb(data, cx - X, j - Y, cw, line);
+    draw_image_mono(line, cx, j, cw, 1, D, 0);
+  }
+  delete[] line;
+}
+
+
+void Fl_Raster_Graphics_Driver::draw_rgb(Fl_RGB_Image *img, int XP, int YP, int WP, int HP, int cx, int cy) {
+  if (!img->d() || !img->array) {
+    Fl_Graphics_Driver::draw_empty(img, XP, YP);
+    return;
+  }
+  if (!buffer_ || start_image(img, XP, YP, WP, HP, cx, cy, XP, YP, WP, HP)) return;
+  // images are not cached: an id_ made here would not be understood by
+  // the platform's graphics driver
+  Fl_RGB_Image *scaled = NULL;
+  const Fl_RGB_Image *src = img;
+  if (img->w() != img->data_w() || img->h() != img->data_h()) {
+    Fl_RGB_Scaling keep = Fl_Image::RGB_scaling();
+    Fl_Image::RGB_scaling(Fl_Image::scaling_algorithm());
+    scaled = (Fl_RGB_Image*)img->copy(img->w(), img->h());
+    Fl_Image::RGB_scaling(keep);
+    src = scaled;
+  }
+  int d = src->d(), ld = src->ld() ? src->ld() : src->data_w() * d;
+  const uchar *p = src->array + cy * ld + cx * d;
+  for (int j = 0; j < HP; j++) {
+    image_row(p + j * ld, d, XP + offset_x_, YP + offset_y_ + j, WP, d < 3, !(d & 1));
+  }
+  delete scaled;
+}
+
+
+void Fl_Raster_Graphics_Driver::draw_pixmap(Fl_Pixmap *pxm, int XP, int YP, int WP, int HP, int cx, int cy) {
+  Fl_RGB_Image rgb(pxm);
+  if (pxm->w() != pxm->data_w() || pxm->h() != pxm->data_h()) rgb.scale(pxm->w(), pxm->h(), 0, 1);
+  draw_rgb(&rgb, XP, YP, WP, HP, cx, cy);
+}
+
+
+void Fl_Raster_Graphics_Driver::draw_bitmap(Fl_Bitmap *bm, int XP, int YP, int WP, int HP, int cx, int cy) {
+  if (!bm->array) {
+    Fl_Graphics_Driver::draw_empty(bm, XP, YP);
+    return;
+  }
+  if (!buffer_ || start_image(bm, XP, YP, WP, HP, cx, cy, XP, YP, WP, HP)) return;
+  Fl_Bitmap *scaled = NULL;
+  const Fl_Bitmap *src = bm;
+  if (bm->w() != bm->data_w() || bm->h() != bm->data_h()) {
+    scaled = (Fl_Bitmap*)bm->copy(bm->w(), bm->h());
+    src = scaled;
+  }
+  int ld = (src->data_w() + 7) / 8;
+  int X = XP + offset_x_, Y = YP + offset_y_;
+  for (int j = 0; j < HP; j++) {
+    const uchar *bits = src->array + (cy + j) * ld;
+    for (int i = 0; i < WP; ) { // draw each run of set bits as a span
+      int k = cx + i;
+      if (!(bits[k >> 3] & (1 << (k & 7)))) { i++; continue; }
+      int start = i;
+      do { i++; k++; } while (i < WP && (bits[k >> 3] & (1 << (k & 7))));
+      span(Y + j, X + start, X + i);
+    }
+  }
+  delete scaled;
+}
+
+
+void Fl_Raster_Graphics_Driver::copy_offscreen(int x, int y, int w, int h, Fl_Offscreen pixmap, int srcx, int srcy) {
+  Fl_Raster_Image_Surface_Driver *surf = Fl_Raster_Image_Surface_Driver::find(pixmap);
+  if (!surf) {
+    Fl_Graphics_Driver::copy_offscreen(x, y, w, h, pixmap, srcx, srcy);
+    return;
+  }
+  Fl_Raster_Graphics_Driver *src = (Fl_Raster_Graphics_Driver*)surf->driver();
+  if (!buffer_) return;
+  // clip the source rectangle to the source buffer
+  if (srcx < 0) { w += srcx; x -= srcx; srcx = 0; }
+  if (srcy < 0) { h += srcy; y -= srcy; srcy = 0; }
+  if (srcx + w > src->width_) w = src->width_ - srcx;
+  if (srcy + h > src->height_) h = src->height_ - srcy;
+  x += offset_x_; y += offset_y_;
+  const Clip_Rect *c = clip_ + clip_start_[rstackptr], *e = c + clip_count_[rstackptr];
+  for (; c < e; c++) {
+    int x0 = x > c->x ? x : c->x, x1 = x + w < c->r ? x + w : c->r;
+    int y0 = y > c->y ? y : c->y, y1 = y + h < c->b ? y + h : c->b;
+    if (x0 >= x1) continue;
+    for (int j = y0; j < y1; j++) {
+      memmove(buffer_ + j * stride_ + x0,
+              src->buffer_ + (srcy + j - y) * src->stride_ + srcx + x0 - x,
+              (x1 - x0) * sizeof(unsigned));
+    }
+  }
+}
+
+/**
+ Copies the w x h pixels at src_x,src_y of the buffer to dest_x,dest_y,
+ like XCopyArea() on a window. The rectangles may overlap. Pixels outside
+ the buffer are neither read nor written.
+ */
+void Fl_Raster_Graphics_Driver::copy_area(int src_x, int src_y, int w, int h, int dest_x, int dest_y) {
+  if (!buffer_) return;
+  src_x += offset_x_; src_y += offset_y_;
+  dest_x += offset_x_; dest_y += offset_y_;
+  // clip the source, then the destination, to the buffer
+  if (src_x < 0) { w += src_x; dest_x -= src_x; src_x = 0; }
+  if (src_y < 0) { h += src_y; dest_y -= src_y; src_y = 0; }
+  if (dest_x < 0) { w += dest_x; src_x -= dest_x; dest_x = 0; }
+  if (dest_y < 0) { h += dest_y; src_y -= dest_y; dest_y = 0; }
+  if (src_x + w > width_) w = width_ - src_x;
+  if (dest_x + w > width_) w = width_ - dest_x;
+  if (src_y + h > height_) h = height_ - src_y;
+  if (dest_y + h > height_) h = height_ - dest_y;
+  if (w <= 0 || h <= 0) return;
+  // copy the rows in the order that does not overwrite rows still to be read
+  int first = 0, last = h, step = 1;
+  if (dest_y > src_y) { first = h - 1; last = -1; step = -1; }
+  for (int j = first; j != last; j += step) {
+    memmove(buffer_ + (dest_y + j) * stride_ + dest_x,
+            buffer_ + (src_y + j) * stride_ + src_x,
+            w * sizeof(unsigned));
+  }
+}
+
+
+//
+// End of "$Id$".
+//
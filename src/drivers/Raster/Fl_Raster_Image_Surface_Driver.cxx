@@ -0,0 +1,81 @@
+//
+// "$Id$"
+//
+// Draw-to-image code of the raster graphics driver for the Fast Light Tool Kit (FLTK).
+//
+// Copyright 2010-2018 by Bill Spitzak and others.
+//
+// This library is free software. Distribution and use rights are outlined in
+// the file "COPYING" which should have been included with this file.  If this
+// file is missing or damaged, see the license at:
+//
+//     http://www.fltk.org/COPYING.php
+//
+// Please report all bugs and problems on the following page:
+//
+//     http://www.fltk.org/str.php
+//
+
+#include "Fl_Raster_Image_Surface_Driver.H"
+#include "Fl_Raster_Graphics_Driver.H"
+#include <string.h>
+
+Fl_Raster_Image_Surface_Driver *Fl_Raster_Image_Surface_Driver::first_ = NULL;
+
+/** Creates a surface of w x h black pixels */
+Fl_Raster_Image_Surface_Driver::Fl_Raster_Image_Surface_Driver(int w, int h) : Fl_Image_Surface_Driver(w, h, 0, 0) {
+  pixels_ = new unsigned[w * h];
+  memset(pixels_, 0, w * h * sizeof(unsigned));
+  offscreen = (Fl_Offscreen)(fl_uintptr_t)pixels_;
+  Fl_Raster_Graphics_Driver *d = new Fl_Raster_Graphics_Driver();
+  d->buffer(pixels_, w, h);
+  driver(d);
+  next_ = first_;
+  first_ = this;
+}
+
+Fl_Raster_Image_Surface_Driver::~Fl_Raster_Image_Surface_Driver() {
+  Fl_Raster_Image_Surface_Driver **p = &first_;
+  while (*p != this) p = &(*p)->next_;
+  *p = next_;
+  delete driver();
+  delete[] pixels_;
+}
+
+/** Returns the surface whose offscreen is \p off, or NULL */
+Fl_Raster_Image_Surface_Driver *Fl_Raster_Image_Surface_Driver::find(Fl_Offscreen off) {
+  for (Fl_Raster_Image_Surface_Driver *s = first_; s; s = s->next_) {
+    if (s->offscreen == off) return s;
+  }
+  return NULL;
+}
+
+void Fl_Raster_Image_Surface_Driver::set_current() {
+  Fl_Surface_Device::set_current();
+}
+
+void Fl_Raster_Image_Surface_Driver::translate(int x, int y) {
+  ((Fl_Raster_Graphics_Driver*)driver())->translate_all(x, y);
+}
+
+void Fl_Raster_Image_Surface_Driver::untranslate() {
+  ((Fl_Raster_Graphics_Driver*)driver())->untranslate_all();
+}
+
+Fl_RGB_Image* Fl_Raster_Image_Surface_Driver::image()
+{
+  uchar *data = new uchar[width * height * 3], *q = data;
+  const unsigned *p = pixels_, *end = p + width * height;
+  for (; p < end; p++, q += 3) {
+    q[0] = uchar(*p >> 16);
+    q[1] = uchar(*p >> 8);
+    q[2] = uchar(*p);
+  }
+  Fl_RGB_Image *image = new Fl_RGB_Image(data, width, height, 3);
+  image->alloc_array = 1;
+  return image;
+}
+
+//
+// End of "$Id$".
+//
@@ -87,6 +87,7 @@ void Fl_X11_Window_Driver::flush_double_dbe(int erase_overlay)
   if (backbuffer_bad || erase_overlay) {
     // Make sure we do a complete redraw...
     if (i->region) {Fl_Graphics_Driver::default_driver().XDestroyRegion(i->region); i->region = 0;}
+    damage_all();
     pWindow->clear_damage(FL_DAMAGE_ALL);
     backbuffer_bad = 0;
   }  
@@ -110,10 +111,16 @@ void Fl_X11_Window_Driver::flush_double_dbe(int erase_overlay)
 void Fl_X11_Window_Driver::destroy_double_buffer() {
 #if USE_XDBE
   if (can_xdbe()) {
+#  if HAVE_XRENDER
+    Fl_Xlib_Graphics_Driver::destroy_picture(other_xid);
+#  endif
     XdbeDeallocateBackBufferName(fl_display, other_xid);
   }
   else
 #endif // USE_XDBE
+#if HAVE_XSHM
+  if (!Fl_Xlib_Graphics_Driver::delete_shm_offscreen(other_xid))
+#endif
     fl_delete_offscreen(other_xid);
   other_xid = 0;
 }
@@ -224,6 +231,12 @@ void Fl_X11_Window_Driver::flush_double(int erase_overlay)
   pWindow->make_current(); // make sure fl_gc is non-zero
   Fl_X *i = Fl_X::i(pWindow);
   if (!other_xid) {
+#if HAVE_XSHM
+    // lets images with alpha be blended on the client without XRender...
+    float s = fl_graphics_driver->scale();
+    other_xid = Fl_Xlib_Graphics_Driver::create_shm_offscreen(int(w()*s), int(h()*s));
+    if (!other_xid)
+#endif
       other_xid = fl_create_offscreen(w(), h());
     pWindow->clear_damage(FL_DAMAGE_ALL);
   }
@@ -471,6 +484,9 @@ void Fl_X11_Window_Driver::hide() {
 # if USE_XFT
   Fl_Xlib_Graphics_Driver::destroy_xft_draw(ip->xid);
   screen_num_ = -1;
+# endif
+# if HAVE_XRENDER
+  Fl_Xlib_Graphics_Driver::destroy_picture(ip->xid);
 # endif
   // this test makes sure ip->xid has not been destroyed already
   if (ip->xid) XDestroyWindow(fl_display, ip->xid);
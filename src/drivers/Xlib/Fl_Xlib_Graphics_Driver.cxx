@@ -41,6 +41,8 @@ Fl_Graphics_Driver *Fl_Graphics_Driver::newMainGraphicsDriver()
 }
 
 GC Fl_Xlib_Graphics_Driver::gc_ = NULL;
+Region Fl_Xlib_Graphics_Driver::gc_clip_ = 0;
+char Fl_Xlib_Graphics_Driver::gc_clip_valid_ = 0;
 
 /* Reference to the current graphics context
  For back-compatibility only. The preferred procedure to get this pointer is
@@ -71,6 +73,7 @@ Fl_Xlib_Graphics_Driver::~Fl_Xlib_Graphics_Driver() {
 
 
 void Fl_Xlib_Graphics_Driver::gc(void *value) {
+  if ((GC)value != gc_) gc_clip_valid_ = 0;
   gc_ = (GC)value;
   fl_gc = gc_;
 }
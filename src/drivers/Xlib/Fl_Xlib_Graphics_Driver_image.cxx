@@ -56,6 +56,7 @@
 #  include "../../Fl_Screen_Driver.H"
 #  include "../../Fl_XColor.H"
 #  include "../../flstring.h"
+#  include "../../fl_pixel_ops.h"
 #if HAVE_XRENDER
 #include <X11/extensions/Xrender.h>
 #endif
@@ -64,6 +65,7 @@ static XImage xi;	// template used to pass info to X
 static int bytes_per_pixel;
 static int scanline_add;
 static int scanline_mask;
+static int direct_delta;	// pixel size of color data that is sent as it is, or 0
 
 static void (*converter)(const uchar *from, uchar *to, int w, int delta);
 static void (*mono_converter)(const uchar *from, uchar *to, int w, int delta);
@@ -321,17 +323,11 @@ static void xrgb_converter(const uchar *from, uchar *to, int w, int delta) {
 }
 
 static void argb_premul_converter(const uchar *from, uchar *to, int w, int delta) {
-  INNARDS32((unsigned(from[3]) << 24) +
-             (((from[0] * from[3]) / 255) << 16) +
-             (((from[1] * from[3]) / 255) << 8) +
-             ((from[2] * from[3]) / 255));
+  fl_pixels_to_argb_premul(from, (unsigned*)to, w, 4, delta);
 }
 
 static void depth2_to_argb_premul_converter(const uchar *from, uchar *to, int w, int delta) {
-  INNARDS32((unsigned(from[1]) << 24) +
-            (((from[0] * from[1]) / 255) << 16) +
-            (((from[0] * from[1]) / 255) << 8) +
-            ((from[0] * from[1]) / 255));
+  fl_pixels_to_argb_premul(from, (unsigned*)to, w, 2, delta);
 }
 
 static void bgrx_converter(const uchar *from, uchar *to, int w, int delta) {
@@ -429,6 +425,7 @@ static void figure_out_visual() {
     if (rs == 0 && gs == 8 && bs == 16) {
       converter = rgb_converter;
       mono_converter = rrr_converter;
+      direct_delta = 3;
     } else if (rs == 16 && gs == 8 && bs == 0) {
       converter = bgr_converter;
       mono_converter = rrr_converter;
@@ -443,9 +440,15 @@ static void figure_out_visual() {
     if (rs == 0 && gs == 8 && bs == 16) {
       converter = xbgr_converter;
       mono_converter = xrrr_converter;
+#  if !WORDS_BIGENDIAN
+      direct_delta = 4;
+#  endif
     } else if (rs == 24 && gs == 16 && bs == 8) {
       converter = rgbx_converter;
       mono_converter = rrrx_converter;
+#  if WORDS_BIGENDIAN
+      direct_delta = 4;
+#  endif
     } else if (rs == 8 && gs == 16 && bs == 24) {
       converter = bgrx_converter;
       mono_converter = rrrx_converter;
@@ -467,6 +470,277 @@ static void figure_out_visual() {
 
 #  define MAXBUFFER 0x40000 // 256k
 
+#if HAVE_XSHM
+#  include <X11/extensions/XShm.h>
+#  include <sys/ipc.h>
+#  include <sys/shm.h>
+
+// Larger images are converted straight into shared memory segments and
+// uploaded with one XShmPutImage() instead of being sent through the X
+// connection in MAXBUFFER strips. A few segments are used in turn, and
+// a segment is only rewritten after the X server has processed the last
+// request that used it. If the extension is missing, or the display is
+// not local so the server can't attach the segments, XPutImage() is used.
+
+#  define SHM_SEGMENTS 2	// number of segments used in turn
+#  define SHM_MIN_SIZE 0x10000	// smaller images are sent with XPutImage()
+
+struct Fl_Xlib_Shm_Segment {
+  XShmSegmentInfo info;
+  size_t size;			// size of segment, 0 if none
+  unsigned long serial;		// request that used it last
+};
+
+static Fl_Xlib_Shm_Segment shm_segments[SHM_SEGMENTS];
+static int shm_next;		// next segment to use
+static int shm_state = -1;	// 1 if MIT-SHM can be used, 0 if not, -1 if unknown
+static int shm_pixmaps;		// can the server create pixmaps in segments?
+static int shm_error;		// set by shm_error_handler()
+
+static int shm_error_handler(Display *, XErrorEvent *) {
+  shm_error = 1;
+  return 0;
+}
+
+// Returns non-zero if the MIT-SHM extension can be used...
+static int shm_available() {
+  if (shm_state < 0) {
+    int major, minor;
+    Bool pixmaps = False;
+    shm_state = XShmQueryExtension(fl_display) &&
+                XShmQueryVersion(fl_display, &major, &minor, &pixmaps);
+    shm_pixmaps = shm_state && pixmaps && XShmPixmapFormat(fl_display) == ZPixmap;
+  }
+  return shm_state;
+}
+
+// Creates a segment of size bytes and attaches it to the server, returns
+// 0 if this fails...
+static int shm_attach(XShmSegmentInfo *info, size_t size, Bool read_only) {
+  info->shmid = shmget(IPC_PRIVATE, size, IPC_CREAT | 0600);
+  if (info->shmid < 0) return 0;
+  info->shmaddr = (char *)shmat(info->shmid, 0, 0);
+  if (info->shmaddr == (char *)-1) {
+    shmctl(info->shmid, IPC_RMID, 0);
+    return 0;
+  }
+  info->readOnly = read_only;
+
+  // Attaching fails asynchronously (e.g. for remote displays), so wait
+  // for the reply and catch the error...
+  XSync(fl_display, False);
+  shm_error = 0;
+  XErrorHandler old_handler = XSetErrorHandler(shm_error_handler);
+  XShmAttach(fl_display, info);
+  XSync(fl_display, False);
+  XSetErrorHandler(old_handler);
+  // The segment is freed when both we and the server have detached it...
+  shmctl(info->shmid, IPC_RMID, 0);
+  if (shm_error) {
+    shmdt(info->shmaddr);
+    return 0;
+  }
+  return 1;
+}
+
+// Returns a shared memory segment of at least size bytes that can be written,
+// or NULL if XPutImage() must be used...
+static Fl_Xlib_Shm_Segment *shm_segment(size_t size) {
+  if (size < SHM_MIN_SIZE || !shm_available()) return 0;
+
+  Fl_Xlib_Shm_Segment *s = shm_segments + shm_next;
+  shm_next = (shm_next + 1) % SHM_SEGMENTS;
+
+  // Wait until the server is done with the segment...
+  if (s->size && (long)(LastKnownRequestProcessed(fl_display) - s->serial) < 0)
+    XSync(fl_display, False);
+  if (s->size >= size) return s;
+
+  if (s->size) {
+    XShmDetach(fl_display, &s->info);
+    shmdt(s->info.shmaddr);
+    s->size = 0;
+  }
+  size = (size + 0xffff) & ~(size_t)0xffff;	// avoid reallocating for small changes
+  if (!shm_attach(&s->info, size, True)) {
+    shm_state = 0;
+    return 0;
+  }
+  s->size = size;
+  return s;
+}
+
+// Uploads rows 0 to h - 1 of xi, which holds image data in segment s,
+// to x, y. The server computes the line size from the image width and
+// its own scanline pad, so xi.width must match xi.bytes_per_line...
+static void shm_put_image(Fl_Xlib_Shm_Segment *s, GC gc, int x, int y, int w, int h) {
+  xi.obdata = (char *)&s->info;
+  xi.width = xi.bytes_per_line / bytes_per_pixel;
+  s->serial = NextRequest(fl_display);
+  XShmPutImage(fl_display, fl_window, gc, &xi, 0, 0, x, y, w, h, False);
+  xi.width = w;
+  xi.obdata = 0;
+}
+
+// Without XRender, images with alpha are blended on the client. Double
+// windows then get back buffers that are pixmaps in shared memory, if the
+// server supports them, and images are blended straight into the pixels
+// of the back buffer instead of reading them with fl_read_image().
+
+struct Fl_Xlib_Shm_Offscreen {
+  Fl_Offscreen pixmap;
+  XShmSegmentInfo info;
+  XImage *image;		// format and pixels of the pixmap
+  Fl_Xlib_Shm_Offscreen *next;
+};
+
+static Fl_Xlib_Shm_Offscreen *shm_offscreens;
+
+/* Creates a back buffer of w x h pixels in shared memory, or returns 0 if
+ this isn't possible. It is only created if images with alpha are blended
+ on the client and can be blended into it.
+ */
+Fl_Offscreen Fl_Xlib_Graphics_Driver::create_shm_offscreen(int w, int h) {
+  fl_open_display();
+  if (fl_can_do_alpha_blending() || !shm_available() || !shm_pixmaps ||
+      fl_visual->c_class != TrueColor || w <= 0 || h <= 0) return 0;
+  Fl_Xlib_Shm_Offscreen *o = new Fl_Xlib_Shm_Offscreen;
+  o->image = XShmCreateImage(fl_display, fl_visual->visual, fl_visual->depth,
+                             ZPixmap, 0, &o->info, w, h);
+  if (o->image) o->image->obdata = 0;	// so that XDestroyImage() doesn't free &o->info
+  if (!o->image || o->image->bits_per_pixel < 8 ||
+      !shm_attach(&o->info, (size_t)o->image->bytes_per_line * h, False)) {
+    if (o->image) XDestroyImage(o->image);
+    delete o;
+    return 0;
+  }
+  o->image->data = o->info.shmaddr;
+  o->pixmap = XShmCreatePixmap(fl_display, RootWindow(fl_display, fl_screen),
+                               o->info.shmaddr, &o->info, w, h, fl_visual->depth);
+  o->next = shm_offscreens;
+  shm_offscreens = o;
+  return o->pixmap;
+}
+
+/* Deletes a back buffer made by create_shm_offscreen(), returns 0 if
+ pixmap is another kind of offscreen.
+ */
+int Fl_Xlib_Graphics_Driver::delete_shm_offscreen(Fl_Offscreen pixmap) {
+  for (Fl_Xlib_Shm_Offscreen **p = &shm_offscreens; *p; p = &(*p)->next) {
+    Fl_Xlib_Shm_Offscreen *o = *p;
+    if (o->pixmap != pixmap) continue;
+    *p = o->next;
+#if HAVE_XRENDER
+    destroy_picture(o->pixmap);
+#endif
+    XFreePixmap(fl_display, o->pixmap);
+    XShmDetach(fl_display, &o->info);
+    XSync(fl_display, False);
+    shmdt(o->info.shmaddr);
+    o->image->data = 0;
+    XDestroyImage(o->image);
+    delete o;
+    return 1;
+  }
+  return 0;
+}
+
+// Position and size of a color channel in a pixel value...
+struct Fl_Xlib_Channel {
+  int shift, bits;
+  Fl_Xlib_Channel(unsigned long mask) : shift(0), bits(0) {
+    if (!mask) return;
+    while (!(mask & 1)) { mask >>= 1; shift++; }
+    while (mask & 1) { mask >>= 1; bits++; }
+  }
+  // the 8-bit value of the channel in pixel p...
+  unsigned get(unsigned long p) const {
+    unsigned v = (unsigned)((p >> shift) & ((1UL << bits) - 1));
+    return bits >= 8 ? v >> (bits - 8) : (v * 255 + (1U << bits) / 2 - 1) / ((1U << bits) - 1);
+  }
+  // the channel bits of 8-bit value v...
+  unsigned long put(unsigned v) const {
+    return (unsigned long)(bits >= 8 ? v << (bits - 8) : v >> (8 - bits)) << shift;
+  }
+};
+
+// Blends an RGBA or gray + alpha pixel over the 8-bit color components
+// of a pixel, like alpha_blend() does...
+static inline unsigned blend_channel(unsigned s, unsigned a, unsigned d) {
+  return (s * a + d * (255 - a)) >> 8;
+}
+
+/* Blends an image with alpha into the current drawable if it is a shared
+ memory back buffer, X, Y, W, H and cx, cy being in pixels like for
+ alpha_blend(). Returns 0 if the drawable is something else.
+ */
+static int shm_alpha_blend(Fl_RGB_Image *img, int X, int Y, int W, int H, int cx, int cy) {
+  Fl_Xlib_Shm_Offscreen *o = shm_offscreens;
+  while (o && o->pixmap != fl_window) o = o->next;
+  if (!o) return 0;
+  XImage *xim = o->image;
+  if (X < 0) { cx -= X; W += X; X = 0; }
+  if (Y < 0) { cy -= Y; H += Y; Y = 0; }
+  if (X + W > xim->width) W = xim->width - X;
+  if (Y + H > xim->height) H = xim->height - Y;
+  if (W <= 0 || H <= 0) return 1;
+  int d = img->d();
+  int ld = img->ld();
+  if (ld == 0) ld = img->data_w() * d;
+  const uchar *src = img->array + cy * ld + cx * d;
+
+  // The server must be done drawing into the pixmap before it is read...
+  XSync(fl_display, False);
+
+  Fl_Xlib_Channel r(xim->red_mask), g(xim->green_mask), b(xim->blue_mask);
+  static const int one = 1;
+  int native = (xim->byte_order == LSBFirst) == (*(const char *)&one == 1);
+  if (xim->bits_per_pixel == 32 && native &&
+      r.bits == 8 && g.bits == 8 && b.bits == 8) {
+    // The usual 24-bit colors, as 32-bit pixels in client byte order...
+    for (int y = 0; y < H; y++, src += ld) {
+      unsigned *p = (unsigned *)(xim->data + (Y + y) * xim->bytes_per_line) + X;
+      const uchar *s = src;
+      for (int x = W; x > 0; x--, p++, s += d) {
+        unsigned a = s[d - 1];
+        if (!a) continue;
+        unsigned sr = s[0], sg = d == 2 ? sr : s[1], sb = d == 2 ? sr : s[2];
+        unsigned v = *p;
+        *p = (v & ~(xim->red_mask | xim->green_mask | xim->blue_mask)) |
+             (blend_channel(sr, a, (v >> r.shift) & 0xff) << r.shift) |
+             (blend_channel(sg, a, (v >> g.shift) & 0xff) << g.shift) |
+             (blend_channel(sb, a, (v >> b.shift) & 0xff) << b.shift);
+      }
+    }
+  } else {
+    for (int y = 0; y < H; y++, src += ld) {
+      const uchar *s = src;
+      for (int x = 0; x < W; x++, s += d) {
+        unsigned a = s[d - 1];
+        if (!a) continue;
+        unsigned sr = s[0], sg = d == 2 ? sr : s[1], sb = d == 2 ? sr : s[2];
+        unsigned long v = XGetPixel(xim, X + x, Y + y);
+        XPutPixel(xim, X + x, Y + y,
+                  r.put(blend_channel(sr, a, r.get(v))) |
+                  g.put(blend_channel(sg, a, g.get(v))) |
+                  b.put(blend_channel(sb, a, b.get(v))));
+      }
+    }
+  }
+  return 1;
+}
+#endif // HAVE_XSHM
+
+// Returns non-zero if the 4th byte of all w x h 32-bit pixels is zero...
+static int unused_bytes_are_zero(const uchar *buf, int w, int h, int linedelta) {
+  for (; h > 0; h--, buf += linedelta) {
+    uchar any = 0;
+    for (int x = 0; x < w; x++) any |= buf[4*x+3];
+    if (any) return 0;
+  }
+  return 1;
+}
+
 static void innards(const uchar *buf, int X, int Y, int W, int H,
 		    int delta, int linedelta, int mono,
 		    Fl_Draw_Image_Cb cb, void* userdata,
@@ -504,40 +778,53 @@ static void innards(const uchar *buf, int X, int Y, int W, int H,
 
   // See if the data is already in the right format.  Unfortunately
   // some 32-bit x servers (XFree86) care about the unknown 8 bits
-  // and they must be zero.  I can't confirm this for user-supplied
-  // data, so the 32-bit shortcut is disabled...
-  // This can set bytes_per_line negative if image is bottom-to-top
-  // I tested it on Linux, but it may fail on other Xlib implementations:
-  if (buf && (
-#  if 0	// set this to 1 to allow 32-bit shortcut
-      delta == 4 &&
-#    if WORDS_BIGENDIAN
-      conv == rgbx_converter
-#    else
-      conv == xbgr_converter
-#    endif
-      ||
-#  endif
-      conv == rgb_converter && delta==3
-      ) && !(linedelta&scanline_add)) {
+  // and they must be zero, so 32-bit data is only sent as it is if
+  // they are. Xlib sends the lines from xi.data on, so bottom-to-top
+  // images are converted too. Only visuals that take the bytes in RGB
+  // order can do this, not the common ones with red at bit 16...
+  int direct = buf && conv == converter && delta == direct_delta &&
+               linedelta > 0 && !(linedelta&scanline_add);
+#if HAVE_XSHM
+  // ...but large images are faster copied to shared memory than sent...
+  if (direct && (long)w*h*bytes_per_pixel >= SHM_MIN_SIZE && shm_available())
+    direct = 0;
+#endif // HAVE_XSHM
+  if (direct &&
+      (delta == 3 || unused_bytes_are_zero(buf+delta*dx+linedelta*dy, w, h, linedelta))) {
     xi.data = (char *)(buf+delta*dx+linedelta*dy);
     xi.bytes_per_line = linedelta;
+    XPutImage(fl_display,fl_window,gc, &xi, 0, 0, X+dx, Y+dy, w, h);
 
   } else {
     int linesize = ((w*bytes_per_pixel+scanline_add)&scanline_mask)/sizeof(STORETYPE);
     int blocking = h;
-    static STORETYPE *buffer;	// our storage, always word aligned
+    static STORETYPE *static_buffer;	// our storage, always word aligned
     static long buffer_size;
-    {int size = linesize*h;
-    if (size > MAXBUFFER) {
-      size = MAXBUFFER;
-      blocking = MAXBUFFER/linesize;
+    STORETYPE *buffer = 0;
+#if HAVE_XSHM
+    // Make the line size a multiple of the pixel size, so that a width
+    // can be given to the server that matches it...
+    int unit = (scanline_add+1)*bytes_per_pixel;
+    int shm_linesize = (w*bytes_per_pixel+unit-1)/unit*unit/sizeof(STORETYPE);
+    Fl_Xlib_Shm_Segment *shm = shm_segment(shm_linesize*h*sizeof(STORETYPE));
+    if (shm) {
+      linesize = shm_linesize;
+      buffer = (STORETYPE *)shm->info.shmaddr;
+    }
+#endif // HAVE_XSHM
+    if (!buffer) {
+      int size = linesize*h;
+      if (size > MAXBUFFER) {
+        size = MAXBUFFER;
+        blocking = MAXBUFFER/linesize;
+      }
+      if (size > buffer_size) {
+        delete[] static_buffer;
+        buffer_size = size;
+        static_buffer = new STORETYPE[size];
+      }
+      buffer = static_buffer;
     }
-    if (size > buffer_size) {
-      delete[] buffer;
-      buffer_size = size;
-      buffer = new STORETYPE[size];
-    }}
     xi.data = (char *)buffer;
     xi.bytes_per_line = linesize*sizeof(STORETYPE);
     if (buf) {
@@ -550,6 +837,10 @@ static void innards(const uchar *buf, int X, int Y, int W, int H,
 	  buf += linedelta;
 	  to += linesize;
 	}
+#if HAVE_XSHM
+	if (shm) shm_put_image(shm, gc, X+dx, Y+dy+j-k, w, k);
+	else
+#endif
 	XPutImage(fl_display,fl_window,gc, &xi, 0, 0, X+dx, Y+dy+j-k, w, k);
       }
     } else {
@@ -562,6 +853,10 @@ static void innards(const uchar *buf, int X, int Y, int W, int H,
 	  conv((uchar*)linebuf, (uchar*)to, w, delta);
 	  to += linesize;
 	}
+#if HAVE_XSHM
+	if (shm) shm_put_image(shm, gc, X+dx, Y+dy+j-k, w, k);
+	else
+#endif
 	XPutImage(fl_display,fl_window,gc, &xi, 0, 0, X+dx, Y+dy+j-k, w, k);
       }
 
@@ -740,7 +1035,10 @@ void Fl_Xlib_Graphics_Driver::draw_fixed(Fl_RGB_Image *img, int X, int Y, int W,
   float keep = d->scale(nscreen);
   d->scale(nscreen, 1);
   push_no_clip();
-  alpha_blend(img, X, Y, W, H, cx, cy);
+#if HAVE_XSHM
+  if (!shm_alpha_blend(img, X, Y, W, H, cx, cy))
+#endif
+    alpha_blend(img, X, Y, W, H, cx, cy);
   pop_clip();
   d->scale(nscreen, keep);
   Fl_Graphics_Driver::scale(s);
@@ -749,6 +1047,70 @@ void Fl_Xlib_Graphics_Driver::draw_fixed(Fl_RGB_Image *img, int X, int Y, int W,
 
 #if HAVE_XRENDER
 
+// Render pictures are kept between draws, so that drawing many images makes
+// few requests: each cached image has a source picture, with the transform
+// last set for it, and the drawables drawn into most recently have
+// a destination picture, with the clip region last set for it.
+
+// Source picture of a cached image, kept in the image's mask_...
+struct Fl_Xlib_Src_Picture {
+  Picture picture;
+  double scale_x, scale_y;	// transform of the picture
+};
+
+#define DST_PICTURES 4		// number of destination pictures kept
+
+static struct {
+  Drawable drawable;
+  Picture picture;
+  int clipped;			// does the picture have a clip region?
+} dst_pictures[DST_PICTURES];	// most recently used first
+
+// Returns the destination picture of fl_window, at dst_pictures[0]...
+static Picture dst_picture(XRenderPictFormat *fmt) {
+  int i;
+  for (i = 0; i < DST_PICTURES - 1; i++)
+    if (dst_pictures[i].drawable == fl_window) break;
+  if (dst_pictures[i].drawable != fl_window && dst_pictures[i].picture) {
+    // drop the least recently used picture...
+    XRenderFreePicture(fl_display, dst_pictures[i].picture);
+    dst_pictures[i].drawable = 0;
+    dst_pictures[i].picture = 0;
+  }
+  for (; i > 0; i--) {
+    Drawable d = dst_pictures[i].drawable;
+    Picture p = dst_pictures[i].picture;
+    int c = dst_pictures[i].clipped;
+    dst_pictures[i] = dst_pictures[i-1];
+    dst_pictures[i-1].drawable = d;
+    dst_pictures[i-1].picture = p;
+    dst_pictures[i-1].clipped = c;
+  }
+  if (!dst_pictures[0].picture) {
+    XRenderPictureAttributes attr;
+    memset(&attr, 0, sizeof(XRenderPictureAttributes));
+    dst_pictures[0].picture = XRenderCreatePicture(fl_display, fl_window, fmt, 0, &attr);
+    dst_pictures[0].drawable = dst_pictures[0].picture ? fl_window : 0;
+    dst_pictures[0].clipped = 0;
+  }
+  return dst_pictures[0].picture;
+}
+
+/* Frees the destination picture of a drawable that is about to be destroyed.
+ */
+void Fl_Xlib_Graphics_Driver::destroy_picture(Drawable id) {
+  for (int i = 0; i < DST_PICTURES; i++) {
+    if (dst_pictures[i].drawable == id && id) {
+      XRenderFreePicture(fl_display, dst_pictures[i].picture);
+      for (; i < DST_PICTURES - 1; i++) dst_pictures[i] = dst_pictures[i+1];
+      dst_pictures[i].drawable = 0;
+      dst_pictures[i].picture = 0;
+      dst_pictures[i].clipped = 0;
+      return;
+    }
+  }
+}
+
 void Fl_Xlib_Graphics_Driver::draw_rgb(Fl_RGB_Image *rgb, int XP, int YP, int WP, int HP, int cx, int cy) {
   if (!fl_can_do_alpha_blending()) {
     Fl_Graphics_Driver::draw_rgb(rgb, XP, YP, WP, HP, cx, cy);
@@ -762,9 +1124,66 @@ void Fl_Xlib_Graphics_Driver::draw_rgb(Fl_RGB_Image *rgb, int XP, int YP, int WP
     cache(rgb);
   }
   cache_size(rgb, W, H);
-  scale_and_render_pixmap( *Fl_Graphics_Driver::id(rgb), rgb->d(),
-                                 rgb->data_w() / double(rgb->w()*scale()), rgb->data_h() / double(rgb->h()*scale()),
-                          cx*scale(), cy*scale(), (X + offset_x_)*scale(), (Y + offset_y_)*scale(), W, H);
+  // Get the source picture of the image, kept until it is uncached...
+  static XRenderPictFormat *fmt24 = XRenderFindStandardFormat(fl_display, PictStandardRGB24);
+  static XRenderPictFormat *fmt32 = XRenderFindStandardFormat(fl_display, PictStandardARGB32);
+  bool has_alpha = (rgb->d() == 2 || rgb->d() == 4);
+  Fl_Xlib_Src_Picture *src = (Fl_Xlib_Src_Picture*)*Fl_Graphics_Driver::mask(rgb);
+  if (!src) {
+    XRenderPictureAttributes attr;
+    memset(&attr, 0, sizeof(XRenderPictureAttributes));
+    Picture p = XRenderCreatePicture(fl_display, (Fl_Offscreen)*Fl_Graphics_Driver::id(rgb),
+                                     has_alpha ? fmt32 : fmt24, 0, &attr);
+    if (!p) {
+      fprintf(stderr, "Failed to create Render picture\n");
+      return;
+    }
+    src = new Fl_Xlib_Src_Picture;
+    src->picture = p;
+    src->scale_x = src->scale_y = 1;
+    *Fl_Graphics_Driver::mask(rgb) = (fl_uintptr_t)src;
+  }
+  double scale_x = rgb->data_w() / double(rgb->w()*scale());
+  double scale_y = rgb->data_h() / double(rgb->h()*scale());
+  if (scale_x != src->scale_x || scale_y != src->scale_y) {
+    XTransform mat = {{
+      { XDoubleToFixed( scale_x ), XDoubleToFixed( 0 ),       XDoubleToFixed( 0 ) },
+      { XDoubleToFixed( 0 ),       XDoubleToFixed( scale_y ), XDoubleToFixed( 0 ) },
+      { XDoubleToFixed( 0 ),       XDoubleToFixed( 0 ),       XDoubleToFixed( 1 ) }
+    }};
+    XRenderSetPictureTransform(fl_display, src->picture, &mat);
+    src->scale_x = scale_x;
+    src->scale_y = scale_y;
+  }
+  composite_picture(src->picture, has_alpha, cx*scale(), cy*scale(),
+                    (X + offset_x_)*scale(), (Y + offset_y_)*scale(), W, H);
+}
+
+/* Composites a Render picture at XP,YP (in pixels) into the current drawable,
+ clipped to the current clip region.
+ */
+int Fl_Xlib_Graphics_Driver::composite_picture(Picture src, bool has_alpha, int srcx, int srcy, int XP, int YP, int WP, int HP) {
+  static XRenderPictFormat *fmt24 = XRenderFindStandardFormat(fl_display, PictStandardRGB24);
+  Picture dst = dst_picture(fmt24);
+  if (!dst) {
+    fprintf(stderr, "Failed to create Render picture\n");
+    return 0;
+  }
+  Fl_Region r = scale_clip(scale());
+  const Fl_Region clipr = clip_region();
+  if (clipr) {
+    XRenderSetPictureClipRegion(fl_display, dst, clipr);
+    dst_pictures[0].clipped = 1;
+  } else if (dst_pictures[0].clipped) {
+    XRenderPictureAttributes attr;
+    attr.clip_mask = None;
+    XRenderChangePicture(fl_display, dst, CPClipMask, &attr);
+    dst_pictures[0].clipped = 0;
+  }
+  unscale_clip(r);
+  XRenderComposite(fl_display, (has_alpha ? PictOpOver : PictOpSrc), src, None, dst, srcx, srcy, 0, 0,
+                   XP, YP, WP, HP);
+  return 1;
 }
 
 /* Draws with Xrender an Fl_Offscreen with optional scaling and accounting for transparency if necessary.
@@ -777,16 +1196,10 @@ int Fl_Xlib_Graphics_Driver::scale_and_render_pixmap(Fl_Offscreen pixmap, int de
   static XRenderPictFormat *fmt24 = XRenderFindStandardFormat(fl_display, PictStandardRGB24);
   static XRenderPictFormat *fmt32 = XRenderFindStandardFormat(fl_display, PictStandardARGB32);
   Picture src = XRenderCreatePicture(fl_display, pixmap, has_alpha ?fmt32:fmt24, 0, &srcattr);
-  Picture dst = XRenderCreatePicture(fl_display, fl_window, fmt24, 0, &srcattr);
-  if (!src || !dst) {
-    fprintf(stderr, "Failed to create Render pictures (%lu %lu)\n", src, dst);
+  if (!src) {
+    fprintf(stderr, "Failed to create Render picture\n");
     return 0;
   }
-  Fl_Region r = scale_clip(scale());
-  const Fl_Region clipr = clip_region();
-  if (clipr)
-    XRenderSetPictureClipRegion(fl_display, dst, clipr);
-  unscale_clip(r);
   if (scale_x != 1 || scale_y != 1) {
     XTransform mat = {{
       { XDoubleToFixed( scale_x ), XDoubleToFixed( 0 ),       XDoubleToFixed( 0 ) },
@@ -795,17 +1208,24 @@ int Fl_Xlib_Graphics_Driver::scale_and_render_pixmap(Fl_Offscreen pixmap, int de
     }};
     XRenderSetPictureTransform(fl_display, src, &mat);
   }
-  XRenderComposite(fl_display, (has_alpha ? PictOpOver : PictOpSrc), src, None, dst, srcx, srcy, 0, 0,
-                   XP, YP, WP, HP);
+  int ok = composite_picture(src, has_alpha, srcx, srcy, XP, YP, WP, HP);
   XRenderFreePicture(fl_display, src);
-  XRenderFreePicture(fl_display, dst);
-  return 1;
+  return ok;
 }
 
 #endif // HAVE_XRENDER
 
 void Fl_Xlib_Graphics_Driver::uncache(Fl_RGB_Image*, fl_uintptr_t &id_, fl_uintptr_t &mask_)
 {
+#if HAVE_XRENDER
+  if (mask_) {
+    Fl_Xlib_Src_Picture *src = (Fl_Xlib_Src_Picture*)mask_;
+    XRenderFreePicture(fl_display, src->picture);
+    delete src;
+    mask_ = 0;
+  }
+  destroy_picture((Fl_Offscreen)id_);
+#endif
   if (id_) {
     XFreePixmap(fl_display, (Fl_Offscreen)id_);
     id_ = 0;
@@ -830,6 +1250,7 @@ void Fl_Xlib_Graphics_Driver::draw_fixed(Fl_Pixmap *pxm, int X, int Y, int W, in
     // make X use the bitmap as a mask:
     XSetClipMask(fl_display, gc_, *Fl_Graphics_Driver::mask(pxm));
     XSetClipOrigin(fl_display, gc_, X-cx, Y-cy);
+    gc_clip_valid_ = 0;
     if (clip_region()) {
       // At this point, XYWH is the bounding box of the intersection between
       // the current clip region and the (portion of the) pixmap we have to draw.
@@ -887,6 +1308,9 @@ void Fl_Xlib_Graphics_Driver::cache(Fl_Pixmap *pxm) {
 }
 
 void Fl_Xlib_Graphics_Driver::uncache_pixmap(fl_uintptr_t offscreen) {
+#if HAVE_XRENDER
+  destroy_picture((Fl_Offscreen)offscreen);
+#endif
   XFreePixmap(fl_display, (Fl_Offscreen)offscreen);
 }
 
@@ -61,7 +61,17 @@ if (*dashes == 0) ndashes = 0;//against error with very small scaling
                      line_width_,
 		     ndashes ? LineOnOffDash : LineSolid,
 		     Cap[(style>>8)&3], Join[(style>>12)&3]);
-  if (ndashes) XSetDashes(fl_display, gc_, 0, dashes, ndashes);
+  // only send dashes that gc_ doesn't have already...
+  static GC dashes_gc;
+  static char dashes_set[8];
+  static int ndashes_set;
+  if (ndashes && (gc_ != dashes_gc || ndashes != ndashes_set ||
+                  memcmp(dashes, dashes_set, ndashes))) {
+    XSetDashes(fl_display, gc_, 0, dashes, ndashes);
+    dashes_gc = ndashes <= (int)sizeof(dashes_set) ? gc_ : 0;
+    if (dashes_gc) memcpy(dashes_set, dashes, ndashes);
+    ndashes_set = ndashes;
+  }
 }
 
 //
@@ -412,16 +412,30 @@ void Fl_Xlib_Graphics_Driver::pop_clip() {
   restore_clip();
 }
 
+// Xlib packs runs of rectangles, lines and points drawn with the same GC
+// into single requests, but any GC change sent between them ends a run.
+// Widgets push and pop clip regions all the time, often getting back the
+// region gc_ already has, so the clip is only sent when it changes.
 void Fl_Xlib_Graphics_Driver::restore_clip() {
   fl_clip_state_number++;
   if (gc_) {
     Region r = rstack[rstackptr];
     if (r) {
       Region r2 = scale_clip(scale());
-      XSetRegion(fl_display, gc_, rstack[rstackptr]);
+      r = rstack[rstackptr];
+      if (!gc_clip_valid_ || !gc_clip_ || !XEqualRegion(r, gc_clip_)) {
+        XSetRegion(fl_display, gc_, r);
+        if (gc_clip_) ::XDestroyRegion(gc_clip_);
+        gc_clip_ = XCreateRegion();
+        XUnionRegion(r, gc_clip_, gc_clip_);
+      }
       unscale_clip(r2);
+    } else if (!gc_clip_valid_ || gc_clip_) {
+      XSetClipMask(fl_display, gc_, 0);
+      if (gc_clip_) ::XDestroyRegion(gc_clip_);
+      gc_clip_ = 0;
     }
-    else XSetClipMask(fl_display, gc_, 0);
+    gc_clip_valid_ = 1;
   }
 }
 
@@ -18,7 +18,9 @@
 
 #include "Fl_Xlib_Graphics_Driver.H"
 #include <FL/Fl_Image_Surface.H>
+#include <FL/platform.H>
 #include "../../Fl_Screen_Driver.H"
+#include "../Raster/Fl_Raster_Image_Surface_Driver.H"
 
 class Fl_Xlib_Image_Surface_Driver : public Fl_Image_Surface_Driver {
   virtual void end_current_();
@@ -34,6 +36,12 @@ public:
 
 Fl_Image_Surface_Driver *Fl_Image_Surface_Driver::newImageSurfaceDriver(int w, int h, int high_res, Fl_Offscreen off)
 {
+  if (!off && !fl_display) {
+    // draw in memory rather than fail when there is no X server
+    Display *d = XOpenDisplay(NULL);
+    if (!d) return new Fl_Raster_Image_Surface_Driver(w, h);
+    fl_open_display(d);
+  }
   return new Fl_Xlib_Image_Surface_Driver(w, h, high_res, off);
 }
 
@@ -53,6 +61,9 @@ Fl_Xlib_Image_Surface_Driver::Fl_Xlib_Image_Surface_Driver(int w, int h, int hig
 }
 
 Fl_Xlib_Image_Surface_Driver::~Fl_Xlib_Image_Surface_Driver() {
+#if HAVE_XRENDER
+  Fl_Xlib_Graphics_Driver::destroy_picture(offscreen);
+#endif
   if (offscreen && !external_offscreen) XFreePixmap(fl_display, offscreen);
   delete driver();
 }
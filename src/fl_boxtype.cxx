@@ -427,6 +427,19 @@ void Fl::set_boxtype(Fl_Boxtype to, Fl_Boxtype from) {
   fl_box_table[to] = fl_box_table[from];
 }
 
+/*
+  Returns whether boxtype t paints all pixels of its bounding box, which
+  is only known for the boxtypes that are rectangles. Fl_Group uses this
+  to skip drawing the children hidden under others.
+*/
+int fl_box_opaque(Fl_Boxtype t) {
+  Fl_Box_Draw_F *f = fl_box_table[t].f;
+  return fl_box_table[t].set &&
+         (f == fl_flat_box || f == fl_up_box || f == fl_down_box ||
+          f == fl_thin_up_box || f == fl_thin_down_box ||
+          f == fl_engraved_box || f == fl_embossed_box || f == fl_border_box);
+}
+
 /**
   Draws a box using given type, position, size and color.
   \param[in] t box type
@@ -0,0 +1,140 @@
+//
+// "$Id$"
+//
+// Internal pixel operations for the Fast Light Tool Kit (FLTK).
+//
+// Copyright 1998-2018 by Bill Spitzak and others.
+//
+// This library is free software. Distribution and use rights are outlined in
+// the file "COPYING" which should have been included with this file.  If this
+// file is missing or damaged, see the license at:
+//
+//     http://www.fltk.org/COPYING.php
+//
+// Please report all bugs and problems on the following page:
+//
+//     http://www.fltk.org/str.php
+//
+
+// These loops are used by Fl_RGB_Image and the image drawing code of the
+// graphics drivers. Each one is written once as an inline function of the
+// depth d and called with a constant d, so that the compiler generates
+// a loop without per-channel tests for each depth, which it can unroll
+// and vectorize. Products with alpha are divided by 255 with shifts, and
+// colors with alpha are processed two channels at a time in 32-bit
+// integers where this is possible.
+
+#include "fl_pixel_ops.h"
+#include <string.h>
+
+// Returns v / 255 rounded, for 0 <= v <= 255 * 255...
+static inline unsigned div255(unsigned v) {
+  v += 128;
+  return (v + (v >> 8)) >> 8;
+}
+
+// Multiplies the two 8-bit channels in bits 0-7 and 16-23 of v with a...
+static inline unsigned mul2(unsigned v, unsigned a) {
+  v = (v & 0x00ff00ff) * a + 0x00800080;
+  return ((v + ((v >> 8) & 0x00ff00ff)) >> 8) & 0x00ff00ff;
+}
+
+
+static inline void blend(const uchar *from, uchar *to, int n, int d,
+                         unsigned ia, const unsigned *k) {
+  for (; n > 0; n --, from += d, to += d) {
+    to[0] = (uchar)((from[0] * ia + k[0]) >> 8);
+    if (d == 2) to[1] = from[1];
+    if (d >= 3) {
+      to[1] = (uchar)((from[1] * ia + k[1]) >> 8);
+      to[2] = (uchar)((from[2] * ia + k[2]) >> 8);
+    }
+    if (d == 4) to[3] = from[3];
+  }
+}
+
+void fl_pixels_blend(const uchar *from, uchar *to, int n, int d,
+                     unsigned ia, uchar r, uchar g, uchar b) {
+  unsigned k[3];
+  if (d < 3) {
+    k[0] = (r * 31 + g * 61 + b * 8) / 100 * (256 - ia);
+  } else {
+    k[0] = r * (256 - ia);
+    k[1] = g * (256 - ia);
+    k[2] = b * (256 - ia);
+  }
+  switch (d) {
+    case 1 : blend(from, to, n, 1, ia, k); break;
+    case 2 : blend(from, to, n, 2, ia, k); break;
+    case 3 : blend(from, to, n, 3, ia, k); break;
+    default : blend(from, to, n, 4, ia, k); break;
+  }
+}
+
+
+// (31 * r + 61 * g + 8 * b) / 100, with the division done as a
+// multiplication that is exact for all possible values...
+static inline uchar gray(const uchar *p) {
+  return (uchar)(((31 * p[0] + 61 * p[1] + 8 * p[2]) * 5243U) >> 19);
+}
+
+static inline void to_gray(const uchar *from, uchar *to, int n, int d) {
+  for (; n > 0; n --, from += d) {
+    *to++ = gray(from);
+    if (d == 4) *to++ = from[3];
+  }
+}
+
+void fl_pixels_gray(const uchar *from, uchar *to, int n, int d) {
+  if (d == 3) to_gray(from, to, n, 3);
+  else to_gray(from, to, n, 4);
+}
+
+
+void fl_pixels_premul(const uchar *from, uchar *to, int n, int d) {
+  const uchar *end = from + n * d;
+  if (d == 4) {
+    for (; from < end; from += 4, to += 4) {
+      unsigned p, a = from[3];
+      memcpy(&p, from, 4);
+      if (a != 255) {
+        // The alpha channel is multiplied too, and restored below. This
+        // works the same with either byte order...
+        p = mul2(p, a) | (mul2(p >> 8, a) << 8);
+        memcpy(to, &p, 4);
+        to[3] = (uchar)a;
+      } else if (to != from) memcpy(to, &p, 4);
+    }
+  } else {
+    for (; from < end; from += 2, to += 2) {
+      to[0] = (uchar)div255(from[0] * from[1]);
+      to[1] = from[1];
+    }
+  }
+}
+
+
+// Returns the premultiplied ARGB value of r, g, b, a...
+static inline unsigned argb_premul(unsigned r, unsigned g, unsigned b, unsigned a) {
+  if (a == 255) return 0xff000000U | (r << 16) | (g << 8) | b;
+  if (!a) return 0;
+  return (a << 24) | mul2((r << 16) | b, a) | (div255(g * a) << 8);
+}
+
+void fl_pixels_to_argb_premul(const uchar *from, unsigned *to, int n,
+                              int d, int delta) {
+  if (d == 4) {
+    for (; n > 0; n --, from += delta)
+      *to++ = argb_premul(from[0], from[1], from[2], from[3]);
+  } else {
+    for (; n > 0; n --, from += delta) {
+      unsigned a = from[1];
+      unsigned v = a == 255 ? from[0] : div255(from[0] * a);
+      *to++ = (a << 24) | (v * 0x10101U);
+    }
+  }
+}
+
+//
+// End of "$Id$".
+//
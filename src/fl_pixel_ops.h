@@ -0,0 +1,59 @@
+//
+// "$Id$"
+//
+// Internal pixel operations for the Fast Light Tool Kit (FLTK).
+//
+// Copyright 1998-2018 by Bill Spitzak and others.
+//
+// This library is free software. Distribution and use rights are outlined in
+// the file "COPYING" which should have been included with this file.  If this
+// file is missing or damaged, see the license at:
+//
+//     http://www.fltk.org/COPYING.php
+//
+// Please report all bugs and problems on the following page:
+//
+//     http://www.fltk.org/str.php
+//
+
+/*
+  ----------------
+  Note to editors:
+  ----------------
+
+  This file may only contain common, platform-independent function
+  declarations used internally in FLTK. It may be #included everywhere
+  in source files in the library, but not in public header files.
+
+  The functions work on n pixels of 8-bit channels, with depth d being
+  1 (gray), 2 (gray + alpha), 3 (RGB) or 4 (RGBA). Unless noted otherwise,
+  'from' and 'to' may point to the same pixels to work in place.
+*/
+
+#ifndef FL_PIXEL_OPS_H
+#define FL_PIXEL_OPS_H
+
+#include <FL/fl_types.h>
+
+// Blends the colors with r, g, b: c = (c * ia + k * (256 - ia)) >> 8,
+// where k is r, g, b (or the gray value of r, g, b for depth 1 and 2).
+// Alpha is copied...
+extern void fl_pixels_blend(const uchar *from, uchar *to, int n, int d,
+                            unsigned ia, uchar r, uchar g, uchar b);
+
+// Converts RGB or RGBA pixels to gray or gray + alpha pixels of depth d - 2...
+extern void fl_pixels_gray(const uchar *from, uchar *to, int n, int d);
+
+// Multiplies the colors of gray + alpha or RGBA pixels with their alpha...
+extern void fl_pixels_premul(const uchar *from, uchar *to, int n, int d);
+
+// Converts gray + alpha or RGBA pixels 'delta' bytes apart to premultiplied
+// 32-bit ARGB values in native byte order. 'from' and 'to' must not overlap...
+extern void fl_pixels_to_argb_premul(const uchar *from, unsigned *to, int n,
+                                     int d, int delta);
+
+#endif // !FL_PIXEL_OPS_H
+
+//
+// End of "$Id$".
+//
@@ -0,0 +1,187 @@
+//
+// "$Id$"
+//
+// Fl_Shared_Image::get_async() test program for the Fast Light Tool Kit (FLTK).
+//
+// Writes a few small PPM files, loads them in the background while the
+// main thread asks for the same images with get(), and checks that every
+// callback is called once and every image has the right size and pixels.
+// Returns 0 if all checks pass.
+//
+// Copyright 1998-2017 by Bill Spitzak and others.
+//
+// This library is free software. Distribution and use rights are outlined in
+// the file "COPYING" which should have been included with this file.  If this
+// file is missing or damaged, see the license at:
+//
+//     http://www.fltk.org/COPYING.php
+//
+// Please report all bugs and problems on the following page:
+//
+//     http://www.fltk.org/str.php
+//
+
+#include <FL/Fl.H>
+#include <FL/Fl_Shared_Image.H>
+#include <FL/fl_utf8.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef _WIN32
+#  include <windows.h>
+#else
+#  include <unistd.h>
+#endif // _WIN32
+
+#define NFILES	8
+#define IMG_W	200
+#define IMG_H	150
+
+static char names[NFILES][32];
+static int callbacks = 0;		// number of callbacks called
+static int failed = 0;			// number of callbacks for failed images
+static int failures = 0;
+
+static void check(const char *what, int ok) {
+  printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+  if (!ok) failures++;
+}
+
+static void loaded_cb(Fl_Shared_Image *img, void *) {
+  callbacks++;
+  if (img->fail()) failed++;
+}
+
+// File i is filled with gray level 20 * i + 10
+static unsigned char gray(int i) {
+  return (unsigned char)(20 * i + 10);
+}
+
+static int write_files() {
+  static unsigned char row[IMG_W * 3];
+  for (int i = 0; i < NFILES; i++) {
+    sprintf(names[i], "async_images_%d.ppm", i);
+    FILE *f = fl_fopen(names[i], "wb");
+    if (!f) return 0;
+    fprintf(f, "P6\n%d %d\n255\n", IMG_W, IMG_H);
+    memset(row, gray(i), sizeof(row));
+    for (int y = 0; y < IMG_H; y++) fwrite(row, 1, sizeof(row), f);
+    fclose(f);
+  }
+  return 1;
+}
+
+// Does img have size W x H and the pixels of file i?
+static int image_ok(Fl_Shared_Image *img, int i, int W, int H) {
+  if (!img || img->fail() || img->w() != W || img->h() != H || img->d() != 3)
+    return 0;
+  const unsigned char *p = (const unsigned char *)img->data()[0];
+  return p[0] == gray(i) && p[(W * H - 1) * 3] == gray(i);
+}
+
+// Run the event loop until 'n' callbacks were called, or for 10 s.
+// Sleep as well, as Fl::wait() doesn't on the headless platform.
+static void wait_callbacks(int n) {
+  for (int i = 0; i < 1000 && callbacks < n; i++) {
+    Fl::wait(0.01);
+#ifdef _WIN32
+    Sleep(10);
+#else
+    usleep(10000);
+#endif // _WIN32
+  }
+}
+
+int main(int argc, char **argv) {
+  fl_register_images();
+  Fl::lock();				// get_async() hands images back with Fl::awake()
+  if (!write_files()) {
+    printf("FAIL: can't write the image files\n");
+    return 1;
+  }
+
+  // Concurrent requests for the same image share one load
+  Fl_Shared_Image *a = Fl_Shared_Image::get_async(names[0], 0, 0, loaded_cb);
+  Fl_Shared_Image *b = Fl_Shared_Image::get_async(names[0], 0, 0, loaded_cb);
+  check("requests for the same image share one shared image", a == b);
+  wait_callbacks(2);
+  check("all callbacks of a shared request are called", callbacks == 2);
+  check("image loaded in the background", image_ok(a, 0, IMG_W, IMG_H));
+  a->release();
+  b->release();
+
+  // get() while the image is still loading waits for it
+  callbacks = 0;
+  a = Fl_Shared_Image::get_async(names[1], 0, 0, loaded_cb);
+  b = Fl_Shared_Image::get(names[1]);
+  check("get() of a loading image returns the loaded image",
+        b == a && image_ok(b, 1, IMG_W, IMG_H));
+  check("get() calls the pending callback first", callbacks == 1);
+  a->release();
+  b->release();
+
+  // get() with a size while the original is still loading
+  callbacks = 0;
+  a = Fl_Shared_Image::get_async(names[2], 0, 0, loaded_cb);
+  b = Fl_Shared_Image::get(names[2], 50, 40);
+  check("get(W, H) of a loading image returns a resized copy",
+        image_ok(b, 2, 50, 40) && image_ok(a, 2, IMG_W, IMG_H));
+  Fl_Shared_Image *c = Fl_Shared_Image::find(names[2], 50, 40);
+  check("the resized copy is cached", c == b);
+  if (c) c->release();
+  a->release();
+  b->release();
+
+  // A file that doesn't exist
+  callbacks = failed = 0;
+  a = Fl_Shared_Image::get_async("async_images_missing.ppm", 0, 0, loaded_cb);
+  b = Fl_Shared_Image::get("async_images_missing.ppm");
+  check("get() of an image that fails to load returns NULL", b == NULL);
+  check("the callback tells that loading failed", callbacks == 1 && failed == 1);
+  a->release();
+
+  // Many requests at once, in several sizes
+  Fl_Shared_Image *imgs[NFILES][2];
+  int i;
+  callbacks = 0;
+  for (i = 3; i < NFILES; i++) {
+    imgs[i][0] = Fl_Shared_Image::get_async(names[i], 0, 0, loaded_cb);
+    imgs[i][1] = Fl_Shared_Image::get_async(names[i], 64, 48, loaded_cb);
+  }
+  wait_callbacks(2 * (NFILES - 3));
+  int ok = (callbacks == 2 * (NFILES - 3));
+  for (i = 3; i < NFILES; i++) {
+    ok = ok && image_ok(imgs[i][0], i, IMG_W, IMG_H) && image_ok(imgs[i][1], i, 64, 48);
+    imgs[i][0]->release();
+    imgs[i][1]->release();
+  }
+  check("many requests load all images in all sizes", ok);
+
+  // stop_async() finishes all requests and stops the threads
+  callbacks = 0;
+  Fl_Shared_Image::cache_size(0);	// (released images were freed)
+  for (i = 0; i < NFILES; i++)
+    imgs[i][0] = Fl_Shared_Image::get_async(names[i], 32, 24, loaded_cb);
+  Fl_Shared_Image::stop_async();
+  ok = 1;
+  for (i = 0; i < NFILES; i++) ok = ok && image_ok(imgs[i][0], i, 32, 24);
+  check("stop_async() finishes all requests", ok);
+  // (images resized from a cached original call back from the event loop)
+  wait_callbacks(NFILES);
+  check("all callbacks are called once", callbacks == NFILES);
+  for (i = 0; i < NFILES; i++) imgs[i][0]->release();
+
+  // Threads are started again afterwards
+  callbacks = 0;
+  a = Fl_Shared_Image::get_async(names[0], 16, 12, loaded_cb);
+  wait_callbacks(1);
+  check("get_async() works after stop_async()", callbacks == 1 && image_ok(a, 0, 16, 12));
+  a->release();
+  Fl_Shared_Image::stop_async();
+
+  for (i = 0; i < NFILES; i++) fl_unlink(names[i]);
+  return failures ? 1 : 0;
+}
+
+//
+// End of "$Id$".
+//
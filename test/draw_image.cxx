@@ -0,0 +1,99 @@
+//
+// "$Id$"
+//
+// fl_draw_image() test program for the Fast Light Tool Kit (FLTK).
+//
+// Draws the same color gradient with 3 and 4 bytes per pixel, with and
+// without padding at the end of the lines, into an offscreen and reads
+// it back. Data that has the layout of the visual is sent to the display
+// as it is, other data is converted; both must give the same pixels.
+// Returns 0 if all checks pass.
+//
+// Copyright 1998-2017 by Bill Spitzak and others.
+//
+// This library is free software. Distribution and use rights are outlined in
+// the file "COPYING" which should have been included with this file.  If this
+// file is missing or damaged, see the license at:
+//
+//     http://www.fltk.org/COPYING.php
+//
+// Please report all bugs and problems on the following page:
+//
+//     http://www.fltk.org/str.php
+//
+
+#include <FL/Fl.H>
+#include <FL/Fl_Image_Surface.H>
+#include <FL/fl_draw.H>
+#include <FL/platform.H>
+#include <stdio.h>
+#include <string.h>
+
+#define W 64
+#define H 48
+#define PAD 8				// padding bytes at the end of lines
+
+static int failures = 0;
+static uchar rgb[H * W * 3], rgbx[H * (W * 4 + PAD)];
+static uchar ref[H * W * 3], pix[H * W * 3];
+
+static void check(const char *what, int ok) {
+  printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+  if (!ok) failures++;
+}
+
+// Fill the RGB image, and the same image with 4 bytes per pixel, where
+// the 4th byte is 'x', and 'ld' bytes per line...
+static void build(uchar x, int ld) {
+  for (int y = 0; y < H; y++) {
+    for (int i = 0; i < W; i++) {
+      uchar *p = rgb + (y * W + i) * 3, *q = rgbx + y * ld + i * 4;
+      q[0] = p[0] = (uchar)(i * 4);
+      q[1] = p[1] = (uchar)(y * 5);
+      q[2] = p[2] = (uchar)(255 - i * 4);
+      q[3] = x;
+    }
+  }
+}
+
+// Draw an image into an offscreen and read its pixels into 'to'
+static void draw(const uchar *buf, int d, int ld, uchar *to) {
+  Fl_Image_Surface surf(W, H);
+  Fl_Surface_Device::push_current(&surf);
+  fl_color(FL_BLACK);
+  fl_rectf(0, 0, W, H);
+  fl_draw_image(buf, 0, 0, W, H, d, ld);
+  fl_read_image(to, 0, 0, W, H);
+  Fl_Surface_Device::pop_current();
+}
+
+int main(int argc, char **argv) {
+  fl_open_display();
+  build(0, W * 4);
+  draw(rgb, 3, 0, ref);
+
+  draw(rgbx, 4, 0, pix);
+  check("4 bytes per pixel, unused byte zero", memcmp(pix, ref, sizeof(ref)) == 0);
+
+  build(0, W * 4 + PAD);
+  draw(rgbx, 4, W * 4 + PAD, pix);
+  check("4 bytes per pixel, padded lines", memcmp(pix, ref, sizeof(ref)) == 0);
+
+  build(0xff, W * 4);
+  draw(rgbx, 4, 0, pix);
+  check("4 bytes per pixel, unused byte set", memcmp(pix, ref, sizeof(ref)) == 0);
+
+  // The last line first...
+  build(0, W * 4);
+  draw(rgbx + (H - 1) * W * 4, 4, -W * 4, pix);
+  int ok = 1;
+  for (int y = 0; y < H; y++)
+    ok = ok && !memcmp(pix + y * W * 3, ref + (H - 1 - y) * W * 3, W * 3);
+  check("4 bytes per pixel, bottom to top", ok);
+
+  return failures ? 1 : 0;
+}
+
+//
+// End of "$Id$".
+//
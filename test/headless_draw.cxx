@@ -0,0 +1,171 @@
+//
+// "$Id$"
+//
+// Headless drawing test program for the Fast Light Tool Kit (FLTK).
+//
+// Checks that partial redraws, occluded children and cached widgets
+// draw less than a full redraw but leave exactly the same pixels.
+// Returns 0 if all checks pass.
+//
+// Copyright 1998-2017 by Bill Spitzak and others.
+//
+// This library is free software. Distribution and use rights are outlined in
+// the file "COPYING" which should have been included with this file.  If this
+// file is missing or damaged, see the license at:
+//
+//     http://www.fltk.org/COPYING.php
+//
+// Please report all bugs and problems on the following page:
+//
+//     http://www.fltk.org/str.php
+//
+
+#include <FL/Fl.H>
+#include <FL/Fl_Window.H>
+#include <FL/Fl_Group.H>
+#include <FL/Fl_Box.H>
+#include <FL/Fl_Toggle_Button.H>
+#include <FL/Fl_Progress.H>
+#include <FL/platform.H>
+#include <stdio.h>
+#include <string.h>
+
+#define W 400
+#define H 300
+
+static int draws = 0;		// number of Counting_Button::draw() calls
+static int failures = 0;
+
+class Counting_Button : public Fl_Toggle_Button {
+public:
+  Counting_Button(int X, int Y, int W_, int H_) : Fl_Toggle_Button(X, Y, W_, H_, "x") {}
+  void draw() { draws++; Fl_Toggle_Button::draw(); }
+};
+
+static void check(const char *what, int ok) {
+  printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+  if (!ok) failures++;
+}
+
+// Copy the window's pixels to buf
+static void snapshot(Fl_Window *win, unsigned *buf) {
+  int w, h;
+  const unsigned *p = fl_headless_pixels(win, &w, &h);
+  memcpy(buf, p, W * H * sizeof(unsigned));
+}
+
+static int same(const unsigned *a, const unsigned *b) {
+  return memcmp(a, b, W * H * sizeof(unsigned)) == 0;
+}
+
+// A group of 6 x 4 counting buttons
+static Fl_Group *panel(int X, int Y, int W_, int H_, Fl_Boxtype bt) {
+  Fl_Group *g = new Fl_Group(X, Y, W_, H_);
+  g->box(bt);
+  for (int i = 0; i < 6; i++)
+    for (int j = 0; j < 4; j++)
+      new Counting_Button(X + 5 + i * 30, Y + 5 + j * 30, 25, 25);
+  g->end();
+  return g;
+}
+
+static unsigned pix_a[W * H], pix_b[W * H];
+
+// Small damage must only draw the children it touches
+static void test_damage() {
+  Fl_Window win(W, H);
+  Fl_Group *g = panel(10, 10, 200, 130, FL_FLAT_BOX);
+  Fl_Box cursor(2, 2, 2, 20);
+  cursor.box(FL_FLAT_BOX);
+  Fl_Progress prog(220, 270, 170, 20);
+  win.end();
+  win.show();
+  Fl::check();
+  draws = 0;
+  for (int k = 0; k < 10; k++) {
+    cursor.color(k & 1 ? FL_BLACK : FL_WHITE);
+    cursor.redraw();
+    prog.value(k * 10);
+    Fl::check();
+  }
+  check("cursor and progress bar redraw no buttons", draws == 0);
+  check("cursor and progress bar repaint few pixels",
+	win.repainted_pixels() < (unsigned long)(W * H / 10));
+  draws = 0;
+  g->child(0)->redraw();
+  g->child(5)->redraw();
+  Fl::check();
+  check("two damaged buttons draw two buttons", draws == 2);
+  snapshot(&win, pix_a);
+  win.redraw();
+  Fl::check();
+  snapshot(&win, pix_b);
+  check("partial redraws match a full redraw", same(pix_a, pix_b));
+  win.hide();
+}
+
+static int run_occlude(int occlude, unsigned *buf) {
+  Fl_Window win(W, H);
+  panel(10, 10, 200, 130, FL_UP_BOX);		// hidden by the next panel
+  panel(0, 0, 250, 150, FL_FLAT_BOX);
+  panel(100, 50, 190, 130, FL_ROUNDED_BOX);	// not opaque
+  panel(0, 100, 300, 100, FL_DOWN_BOX);
+  win.end();
+  win.occlude_children(occlude);
+  win.show();
+  draws = 0;
+  Fl::check();
+  snapshot(&win, buf);
+  win.hide();
+  return draws;
+}
+
+// Children hidden by opaque siblings must not be drawn
+static void test_occlude() {
+  int d0 = run_occlude(0, pix_a);
+  int d1 = run_occlude(1, pix_b);
+  check("occluded panel is not drawn", d1 <= d0 - 24);
+  check("occlusion leaves the same pixels", same(pix_a, pix_b));
+}
+
+static int run_cached(int cache, unsigned *buf) {
+  Fl_Window win(W, H);
+  Fl_Group *g = panel(10, 10, 200, 130, FL_DOWN_BOX);
+  g->color(FL_YELLOW);
+  win.end();
+  g->cached(cache);
+  win.show();
+  Fl::check();
+  draws = 0;
+  win.redraw();
+  Fl::check();
+  int d = draws;
+  ((Fl_Button *)g->child(0))->value(1);
+  g->child(0)->redraw();
+  Fl::check();
+  win.redraw();
+  Fl::check();
+  snapshot(&win, buf);
+  win.hide();
+  return d;
+}
+
+// A cached group must be blitted, not drawn, when nothing in it changed
+static void test_cached() {
+  int d0 = run_cached(0, pix_a);
+  int d1 = run_cached(1, pix_b);
+  check("uncached group draws its buttons", d0 == 24);
+  check("cached group is copied from its image", d1 == 0);
+  check("cached group leaves the same pixels", same(pix_a, pix_b));
+}
+
+int main(int argc, char **argv) {
+  test_damage();
+  test_occlude();
+  test_cached();
+  return failures ? 1 : 0;
+}
+
+//
+// End of "$Id$".
+//
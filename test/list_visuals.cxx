@@ -24,7 +24,7 @@
 //     http://www.fltk.org/str.php
 //
 
-#if defined(_WIN32) || defined(__APPLE__)
+#if defined(_WIN32) || defined(__APPLE__) || defined(USE_HEADLESS)
 #include <FL/Fl.H>
 #include <FL/fl_message.H>
 
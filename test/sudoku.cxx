@@ -35,7 +35,7 @@
 
 #ifdef _WIN32
 #  include "sudokurc.h"
-#elif !defined(__APPLE__)
+#elif !defined(__APPLE__) && !defined(USE_HEADLESS)
 #  include "pixmaps/sudoku.xbm"
 #endif // _WIN32
 
@@ -454,6 +454,7 @@ void SudokuSound::play(char note) {
   }
 #  endif // HAVE_ALSA_ASOUNDLIB_H
 
+#  ifndef USE_HEADLESS
   // Just use standard X11 stuff...
   XKeyboardState	state;
   XKeyboardControl	control;
@@ -480,6 +481,7 @@ void SudokuSound::play(char note) {
   XChangeKeyboardControl(fl_display,
                          KBBellPercent | KBBellPitch | KBBellDuration,
 			 &control);
+#  endif // !USE_HEADLESS
 #endif // __APPLE__
 }
 
@@ -707,7 +709,7 @@ Sudoku::Sudoku()
   // Set icon for window (MacOS uses app bundle for icon...)
 #ifdef _WIN32
   icon((char *)LoadIcon(fl_display, MAKEINTRESOURCE(IDI_ICON)));
-#elif !defined(__APPLE__)
+#elif !defined(__APPLE__) && !defined(USE_HEADLESS)
   fl_open_display();
   icon((char *)XCreateBitmapFromData(fl_display, DefaultRootWindow(fl_display),
                                      (char *)sudoku_bits, sudoku_width,
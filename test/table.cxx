@@ -175,6 +175,12 @@ void setcolresize_cb(Fl_Widget*, void *data)
     G_table->col_resize(check->value());
 }
 
+void setcellcache_cb(Fl_Widget*, void *data)
+{
+    Fl_Check_Button *check = (Fl_Check_Button*)data;
+    G_table->cell_cache(check->value());
+}
+
 void setpositionrow_cb(Fl_Widget *w, void *data)
 {
     Fl_Input *in = (Fl_Input*)data;
@@ -487,6 +493,11 @@ int main(int argc, char **argv)
     cellfgcolor.callback(setcellfgcolor_cb, (void*)&cellfgcolor);
     cellfgcolor.when(FL_WHEN_RELEASE);
 
+    Fl_Check_Button cellcache(550, 670, 120, 25, "Cell Cache?");
+    cellcache.labelsize(12);
+    cellcache.callback(setcellcache_cb, (void*)&cellcache);
+    cellcache.value(G_table->cell_cache() ? 1 : 0);
+
     Fl_Choice type(650, 640, 120, 25, "Type");
     type.labelsize(12);
     type.textsize(12);
@@ -35,7 +35,7 @@ void button_cb(Fl_Widget *,void *) {
 }
 
 #include <FL/platform.H>
-#if !defined(_WIN32) && !defined(__APPLE__)
+#if !defined(_WIN32) && !defined(__APPLE__) && !defined(USE_HEADLESS)
 #include "list_visuals.cxx"
 #endif
 
@@ -51,7 +51,7 @@ int arg(int argc, char **argv, int &i) {
 }
 
 int main(int argc, char **argv) {
-#if !defined(_WIN32) && !defined(__APPLE__)
+#if !defined(_WIN32) && !defined(__APPLE__) && !defined(USE_HEADLESS)
   int i = 1;
 
   Fl::args(argc,argv,i,arg);
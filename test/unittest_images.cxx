@@ -21,6 +21,14 @@
 #include <FL/Fl_Radio_Button.H>
 #include <FL/Fl_Check_Button.H>
 #include <FL/fl_draw.H>
+#include <FL/Fl_Box.H>
+#include <math.h>
+#include <time.h>
+#ifdef _WIN32
+#  include <windows.h>
+#else
+#  include <sys/time.h>
+#endif
 
 // Note: currently (March 2010) fl_draw_image() supports transparency with
 //	 alpha channel only on Apple (Mac OS X), but Fl_RGB_Image->draw()
@@ -295,6 +303,164 @@ Fl_RGB_Image *ImageTest::i_rgba = 0;
 
 UnitTest images("drawing images", ImageTest::create);
 
+//
+//------- test the scaling methods of Fl_RGB_Image::copy() ----------
+//
+
+class ImageScaleTest : public Fl_Group {
+  static Fl_RGB_Image *zone;	// zone plate pattern, shows aliasing
+  static Fl_RGB_Image *small_img;	// small image to enlarge
+  Fl_RGB_Image *shrunk[4], *grown[4];
+  Fl_Box *results;
+  char text[1024];
+
+  static const char *method_name(int m) {
+    static const char *names[] = { "Nearest", "Bilinear", "Area", "Bicubic" };
+    return names[m];
+  }
+
+  static double now() {
+#ifdef _WIN32
+    LARGE_INTEGER t, freq;
+    QueryPerformanceCounter(&t);
+    QueryPerformanceFrequency(&freq);
+    return (double)t.QuadPart / (double)freq.QuadPart;
+#else
+    struct timeval t;
+    gettimeofday(&t, 0);
+    return t.tv_sec + t.tv_usec / 1000000.0;
+#endif
+  }
+
+  static void build_imgs() {
+    int x, y;
+    delete zone;
+    delete small_img;
+    uchar *p = new uchar[256*256*4];
+    zone = new Fl_RGB_Image(p, 256, 256, 4);
+    zone->alloc_array = 1;
+    for (y=0; y<256; y++) {
+      for (x=0; x<256; x++) {
+        double r2 = (x-128)*(x-128) + (y-128)*(y-128);
+        uchar v = (uchar)(127.5 + 127.5 * cos(r2 * 3.14159265358979 / 256.0));
+        *p++ = v; *p++ = v; *p++ = 255-v; *p++ = (uchar)(255 - (x+y)/4);
+      }
+    }
+    p = new uchar[8*8*3];
+    small_img = new Fl_RGB_Image(p, 8, 8, 3);
+    small_img->alloc_array = 1;
+    for (y=0; y<8; y++) {
+      for (x=0; x<8; x++) {
+        *p++ = (uchar)(x*36); *p++ = ((x^y)&1) ? 255 : 0; *p++ = (uchar)(y*36);
+      }
+    }
+  }
+
+  // Scales an image of w x h x d pixels of one color and checks that all
+  // scaled pixels have that color, give or take tol...
+  static int check_flat(int w, int h, int d, int W, int H, int tol) {
+    uchar *p = new uchar[w*h*d];
+    for (int i=0; i<w*h*d; i++) p[i] = (uchar)(40 + (i%d)*50);
+    Fl_RGB_Image src(p, w, h, d);
+    Fl_RGB_Image *dst = (Fl_RGB_Image*)src.copy(W, H);
+    int ok = (dst->w() == W && dst->h() == H);
+    for (int i=0; ok && i<W*H*d; i++)
+      if (abs(dst->array[i] - (40 + (i%d)*50)) > tol) ok = 0;
+    delete dst;
+    delete[] p;
+    return ok;
+  }
+
+  static void benchmark_CB(Fl_Widget*, void *data) {
+    ImageScaleTest *it = (ImageScaleTest*)data;
+    Fl_RGB_Scaling keep = Fl_Image::RGB_scaling();
+    int W0 = 3000, H0 = 2000, m, i;
+    uchar *p = new uchar[W0*H0*4];
+    for (i=0; i<W0*H0*4; i++) p[i] = (uchar)(i*31 + (i>>12));
+    Fl_RGB_Image big(p, W0, H0, 4);
+    int sizes[3][2] = { {750, 500}, {150, 100}, {6000, 4000} };
+    char *t = it->text;
+    t += sprintf(t, "copy() of a %dx%d RGBA image, best of 3 (ms):\n", W0, H0);
+    for (m=0; m<4; m++) {
+      Fl_Image::RGB_scaling((Fl_RGB_Scaling)m);
+      // the bilinear method truncates when it premultiplies alpha
+      int ok = 1, tol = (m == FL_RGB_SCALING_BILINEAR) ? 3 : 1;
+      for (int d=1; d<=4; d++) {
+        ok &= check_flat(64, 64, d, 64, 64, tol) && check_flat(64, 64, d, 7, 3, tol) &&
+              check_flat(64, 64, d, 333, 501, tol) && check_flat(5, 9, d, 1, 1, tol);
+      }
+      t += sprintf(t, "%-8s %s", method_name(m), ok ? "ok  " : "FAIL");
+      for (i=0; i<3; i++) {
+        double best = 1e9;
+        for (int n=0; n<3; n++) {
+          double t0 = now();
+          Fl_Image *img = big.copy(sizes[i][0], sizes[i][1]);
+          double t1 = now();
+          delete img;
+          if (t1 - t0 < best) best = t1 - t0;
+        }
+        t += sprintf(t, "  %dx%d: %6.1f", sizes[i][0], sizes[i][1], best * 1000.0);
+      }
+      t += sprintf(t, "\n");
+    }
+    delete[] p;
+    Fl_Image::RGB_scaling(keep);
+    it->results->label(it->text);
+    it->redraw();
+  }
+
+public:
+  static Fl_Widget *create() {
+    build_imgs();
+    return new ImageScaleTest(TESTAREA_X, TESTAREA_Y, TESTAREA_W, TESTAREA_H);
+  }
+
+  ImageScaleTest(int x, int y, int w, int h) : Fl_Group(x, y, w, h) {
+    label("Testing Image Scaling\n\n"
+	"The zone plate is shrunk to 1/3, and an 8x8 image is enlarged,\n"
+	"with each Fl_RGB_Scaling method. Shrinking should not show\n"
+	"moire patterns with Area and Bicubic.");
+    align(FL_ALIGN_INSIDE|FL_ALIGN_BOTTOM|FL_ALIGN_LEFT|FL_ALIGN_WRAP);
+    box(FL_BORDER_BOX);
+    Fl_RGB_Scaling keep = Fl_Image::RGB_scaling();
+    for (int m=0; m<4; m++) {
+      Fl_Image::RGB_scaling((Fl_RGB_Scaling)m);
+      shrunk[m] = (Fl_RGB_Image*)zone->copy(85, 85);
+      grown[m] = (Fl_RGB_Image*)small_img->copy(85, 85);
+    }
+    Fl_Image::RGB_scaling(keep);
+    Fl_Button *b = new Fl_Button(x+10, y+205, 95, 25, "Benchmark");
+    b->callback(benchmark_CB, (void*)this);
+    results = new Fl_Box(x+10, y+235, w-20, 80);
+    results->align(FL_ALIGN_INSIDE|FL_ALIGN_TOP_LEFT);
+    results->labelfont(FL_COURIER);
+    results->labelsize(11);
+    end();
+  }
+
+  ~ImageScaleTest() {
+    for (int m=0; m<4; m++) { delete shrunk[m]; delete grown[m]; }
+  }
+
+  void draw() {
+    Fl_Group::draw();
+    for (int m=0; m<4; m++) {
+      int xx = x()+10+m*125, yy = y()+10;
+      fl_color(FL_BLACK);
+      fl_rect(xx, yy, 87, 87);
+      fl_rect(xx, yy+102, 87, 87);
+      shrunk[m]->draw(xx+1, yy+1);
+      grown[m]->draw(xx+1, yy+103);
+      fl_draw(method_name(m), xx, yy+100);
+    }
+  }
+};
+
+Fl_RGB_Image *ImageScaleTest::zone = 0;
+Fl_RGB_Image *ImageScaleTest::small_img = 0;
+
+UnitTest image_scaling("scaling images", ImageScaleTest::create);
+
 //
 // End of "$Id$"
 //